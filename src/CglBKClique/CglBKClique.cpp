@@ -18,11 +18,13 @@
 
 #include <cstdio>
 #include <cassert>
+#include <algorithm>
 #include <OsiCuts.hpp>
 #include <OsiRowCut.hpp>
 #include <CoinTime.hpp>
 
 #include "CglBKClique.hpp"
+#include "CglSolutionDigest.hpp"
 #include "CoinConflictGraph.hpp"
 #include "CoinStaticConflictGraph.hpp"
 #include "CoinBronKerbosch.hpp"
@@ -61,6 +63,7 @@ CglBKClique::CglBKClique(const CglBKClique& rhs) : CglCutGenerator(rhs) {
         this->rc_ = (double*)xmalloc(sizeof(double) * this->cap_ * 2);
         this->idxs_ = (int*)xmalloc(sizeof(int) * this->cap_);
         this->idxMap_ = (int*)xmalloc(sizeof(int) * this->cap_);
+        std::fill(this->idxMap_, this->idxMap_ + this->cap_, -1);
         this->coefs_ = (double*)xmalloc(sizeof(double) * this->cap_);
         this->inducedVert_ = (size_t*)xmalloc(sizeof(size_t) * this->cap_ * 2);
         this->currClq_ = (size_t*)xmalloc(sizeof(size_t) * this->cap_ * 2);
@@ -120,6 +123,11 @@ void CglBKClique::generateCuts(const OsiSolverInterface &si, OsiCuts &cs, const
 	if (si.getNumCols() == 0 || si.getNumRows() == 0) {
         return;
     }
+
+    //no clique can be violated if shared digest has all binaries at 0 or 1
+    if (CglSolutionDigest::noneFractional(si, info, 1.0e-9)) {
+        return;
+    }
     
     double startSep = CoinCpuTime();
     const CoinConflictGraph *cgraph = si.getCGraph();
@@ -173,6 +181,8 @@ void CglBKClique::checkMemory(const size_t newNumCols) {
         rc_ = (double*)xmalloc(sizeof(double) * newNumCols * 2);
         idxs_ = (int*)xmalloc(sizeof(int) * newNumCols);
         idxMap_ = (int*)xmalloc(sizeof(int) * newNumCols);
+        //idxMap_ is kept at -1 outside insertCuts
+        std::fill(idxMap_, idxMap_ + newNumCols, -1);
         coefs_ = (double*)xmalloc(sizeof(double) * newNumCols);
         inducedVert_ = (size_t*)xmalloc(sizeof(size_t) * newNumCols * 2);
         currClq_ = (size_t*)xmalloc(sizeof(size_t) * newNumCols * 2);
@@ -263,13 +273,15 @@ CoinCliqueList* CglBKClique::extendCliques(const OsiSolverInterface &si, const C
     const size_t numCols = si.getNumCols();
     const CoinConflictGraph *cgraph = si.getCGraph();
 
-    //setting reduced costs
-    for (size_t i = 0; i < numCols; i++) {
-        rc_[i] = rCost[i];
-        rc_[i + numCols] = -rc_[i];
+    //setting reduced costs (only extension methods 4 and up look at them)
+    if (extMethod_ >= 4) {
+        for (size_t i = 0; i < numCols; i++) {
+            rc_[i] = rCost[i];
+            rc_[i + numCols] = -rc_[i];
+        }
     }
 
-    CoinCliqueExtender clqe(cgraph, extMethod_, rc_, 100.0);
+    CoinCliqueExtender clqe(cgraph, extMethod_, extMethod_ >= 4 ? rc_ : NULL, 100.0);
 
     for (size_t i = 0; i < initialCliques->nCliques(); i++) {
         const size_t *clqEl = initialCliques->cliqueElements(i);
@@ -302,8 +314,6 @@ void CglBKClique::insertCuts(const OsiSolverInterface &si, const CglTreeInfo &in
         int cutSize = 0;
         size_t duplicated = 0;
 
-        std::fill(idxMap_, idxMap_ + numCols, -1);
-
         for (size_t j = 0; j < clqSize; j++) {
             if (el[j] < numCols) {
                 if(idxMap_[el[j]] == -1) {
@@ -350,6 +360,11 @@ void CglBKClique::insertCuts(const OsiSolverInterface &si, const CglTreeInfo &in
         }
 
         cutpool.add(idxs_, coefs_, cutSize, rhs);
+
+        //resetting only the positions used by this clique
+        for (size_t j = 0; j < clqSize; j++) {
+            idxMap_[el[j] < numCols ? el[j] : el[j] - numCols] = -1;
+        }
     }
 
     cutpool.removeNullCuts();
@@ -4,11 +4,15 @@
 
 #include <cstdio>
 #include <cassert>
+#include <algorithm>
+#include <numeric>
 
 #include "CoinHelperFunctions.hpp"
 #include "OsiCuts.hpp"
 #include "OsiRowCut.hpp"
 #include "CglClique.hpp"
+#include "CglModelComponents.hpp"
+#include "CglSolutionDigest.hpp"
 
 /* to prevent the creation of very
  * large incidence matrixes */
@@ -34,6 +38,8 @@ CglClique::CglClique(bool setPacking, bool justOriginalRows) :
    node_node(0),
    petol(-1.0),
    maxNumber_(5000),
+   probingInfo_(NULL),
+   activeProbingInfo_(NULL),
    do_row_clique(true),
    do_star_clique(true),
    scl_next_node_rule(SCL_MAX_XJ_MAX_DEG),
@@ -65,6 +71,8 @@ CglClique::CglClique(const CglClique& rhs)
     node_node(rhs.node_node),
     petol(rhs.petol),
     maxNumber_(rhs.maxNumber_),
+    probingInfo_(rhs.probingInfo_),
+    activeProbingInfo_(NULL),
     do_row_clique(rhs.do_row_clique),
     do_star_clique(rhs.do_star_clique),
     scl_next_node_rule(rhs.scl_next_node_rule),
@@ -97,15 +105,17 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
    int numberOriginalRows = si.getNumRows();
    if (info.inTree&&justOriginalRows_)
      numberOriginalRows = info.formulation_rows;
-   int numberRowCutsBefore = cs.sizeRowCuts();
+   const CglSolutionDigest * digest = info.solutionDigest;
+   if (digest && !digest->matches(si, info))
+      digest = NULL;
    // First select which rows/columns we are interested in.
    if (!setPacking_) {
-      selectFractionalBinaries(si);
+      selectFractionalBinaries(si,digest);
       if (!sp_orig_row_ind) {
 	 selectRowCliques(si,numberOriginalRows);
       }
    } else {
-      selectFractionals(si);
+      selectFractionals(si,digest);
       delete[] sp_orig_row_ind;
       sp_numrows = numberOriginalRows;
       //sp_numcols = si.getNumCols();
@@ -113,6 +123,113 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
       for (i = 0; i < sp_numrows; ++i)
 	 sp_orig_row_ind[i] = i;
    }
+   // Use independent blocks if given and for this model
+   const CglModelComponents * components = info.components;
+   if (components && (components->numberComponents() < 2 ||
+		      components->numberColumns() != si.getNumCols() ||
+		      components->numberRows() != si.getNumRows()))
+      components = NULL;
+   // Stored cliques from probing only if for this model
+   activeProbingInfo_ = probingInfo_;
+   if (activeProbingInfo_ &&
+       (!activeProbingInfo_->numberCliques() ||
+	activeProbingInfo_->numberVariables() != si.getNumCols()))
+      activeProbingInfo_ = NULL;
+
+   if (!separateSelected(si, components, cs, info)) {
+      activeProbingInfo_ = NULL;
+      return; // too many rows or too few columns!
+   }
+   activeProbingInfo_ = NULL;
+
+   if (! has_petol_set)
+      petol = -1;
+}
+
+/*****************************************************************************/
+
+void
+CglClique::generateCutsMulti(const OsiSolverInterface& si, int numberPoints,
+			     const double * const * solutions,
+			     const double * const * ,
+			     const double * const * ,
+			     OsiCuts * cs, const CglTreeInfo info)
+{
+   if (numberPoints <= 0)
+      return;
+   int i;
+   bool has_petol_set = petol != -1.0;
+
+   if (! has_petol_set)
+      si.getDblParam(OsiPrimalTolerance, petol);
+   int numberOriginalRows = si.getNumRows();
+   if (info.inTree&&justOriginalRows_)
+     numberOriginalRows = info.formulation_rows;
+   // Work which does not depend on point
+   // rows given by considerRows are used for every point
+   int numberGivenRows = 0;
+   int * givenRows = NULL;
+   char * possibleRow = NULL;
+   if (!setPacking_) {
+      if (sp_orig_row_ind) {
+	 numberGivenRows = sp_numrows;
+	 givenRows = CoinCopyOfArray(sp_orig_row_ind, sp_numrows);
+      } else {
+	 possibleRow = new char [si.getNumRows()];
+	 markPossibleRowCliques(si, numberOriginalRows, possibleRow);
+      }
+   }
+   const CglModelComponents * components = info.components;
+   if (components && (components->numberComponents() < 2 ||
+		      components->numberColumns() != si.getNumCols() ||
+		      components->numberRows() != si.getNumRows()))
+      components = NULL;
+   activeProbingInfo_ = probingInfo_;
+   if (activeProbingInfo_ &&
+       (!activeProbingInfo_->numberCliques() ||
+	activeProbingInfo_->numberVariables() != si.getNumCols()))
+      activeProbingInfo_ = NULL;
+
+   for (int k = 0; k < numberPoints; ++k) {
+      if (!setPacking_) {
+	 delete[] sp_orig_row_ind;
+	 sp_orig_row_ind = NULL;
+	 selectFractionalBinaries(si, NULL, solutions[k]);
+	 if (givenRows) {
+	    sp_numrows = numberGivenRows;
+	    sp_orig_row_ind = CoinCopyOfArray(givenRows, numberGivenRows);
+	 } else {
+	    selectRowCliques(si, numberOriginalRows, possibleRow);
+	 }
+      } else {
+	 selectFractionals(si, NULL, solutions[k]);
+	 delete[] sp_orig_row_ind;
+	 sp_numrows = numberOriginalRows;
+	 sp_orig_row_ind = new int[sp_numrows];
+	 for (i = 0; i < sp_numrows; ++i)
+	    sp_orig_row_ind[i] = i;
+      }
+      separateSelected(si, components, cs[k], info);
+   }
+   delete[] givenRows;
+   delete[] possibleRow;
+   activeProbingInfo_ = NULL;
+
+   if (! has_petol_set)
+      petol = -1;
+}
+
+/*===========================================================================*
+ * Separate cliques for the selected columns and rows (of one point) and
+ * delete the selection.
+ *===========================================================================*/
+
+bool
+CglClique::separateSelected(const OsiSolverInterface& si,
+			    const CglModelComponents * components,
+			    OsiCuts& cs, const CglTreeInfo& info)
+{
+   int numberRowCutsBefore = cs.sizeRowCuts();
    // Just original rows
    if (justOriginalRows_&&info.inTree) 
      sp_numrows = CoinMin(info.formulation_rows,sp_numrows);
@@ -120,13 +237,37 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
 #ifndef MAX_CGLCLIQUE_ROWS
 #define MAX_CGLCLIQUE_ROWS 100000
 #endif
-   if (sp_numrows > MAX_CGLCLIQUE_ROWS || sp_numcols < 2 || sp_numcols>MAX_CGLCLIQUE_COLS) {
+   if (sp_numrows > MAX_CGLCLIQUE_ROWS || sp_numcols < 2 ||
+       (sp_numcols>MAX_CGLCLIQUE_COLS && !components)) {
      //printf("sp_numrows is %d\n",sp_numrows);
      deleteSetPackingSubMatrix();
-     return; // too many rows or too few columns!
+     return false; // too many rows or too few columns!
    }
 
-   createSetPackingSubMatrix(si);
+   if (!components) {
+      createSetPackingSubMatrix(si);
+      separateGraph(cs);
+   } else {
+      separateComponents(si, *components, cs);
+   }
+   if (!info.inTree&&((info.options&4)==4||((info.options&8)&&!info.pass))) {
+      int numberRowCutsAfter = cs.sizeRowCuts();
+      for (int i=numberRowCutsBefore;i<numberRowCutsAfter;i++)
+	 cs.rowCutPtr(i)->setGloballyValid();
+   }
+
+   deleteSetPackingSubMatrix();
+   return true;
+}
+
+/*===========================================================================*
+ * Build the intersection graph for the current set packing submatrix and
+ * look for violated cliques in it. Leaves sp_orig_* alone.
+ *===========================================================================*/
+
+void
+CglClique::separateGraph(OsiCuts& cs)
+{
    fgraph.edgenum = createNodeNode();
    createFractionalGraph();
 
@@ -138,11 +279,6 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
        find_rcl(cs);
      if (do_star_clique)
        find_scl(cs);
-     if (!info.inTree&&((info.options&4)==4||((info.options&8)&&!info.pass))) {
-       int numberRowCutsAfter = cs.sizeRowCuts();
-       for (int i=numberRowCutsBefore;i<numberRowCutsAfter;i++)
-	 cs.rowCutPtr(i)->setGloballyValid();
-     }
    }
 
    delete[] cl_indices;     cl_indices = 0;
@@ -150,10 +286,118 @@ CglClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
 
    deleteFractionalGraph();
    delete[] node_node;      node_node = 0;
-   deleteSetPackingSubMatrix();
+   delete[] sp_col_start;   sp_col_start = 0;
+   delete[] sp_col_ind;     sp_col_ind = 0;
+   delete[] sp_row_start;   sp_row_start = 0;
+   delete[] sp_row_ind;     sp_row_ind = 0;
+}
 
-   if (! has_petol_set)
-      petol = -1;
+/*===========================================================================*
+ * No clique can span two independent blocks of the model so split the
+ * selected columns and rows by block and separate each block on its own.
+ * Graphs (and node_node) are then only as large as a block.
+ *===========================================================================*/
+
+void
+CglClique::separateBlock(const OsiSolverInterface& si,
+			 int numberColumns, int* columns, double* solution,
+			 int numberRows, int* rows, int* rowMap, OsiCuts& cs)
+{
+   sp_numcols = numberColumns;
+   sp_orig_col_ind = columns;
+   sp_colsol = solution;
+   sp_numrows = numberRows;
+   sp_orig_row_ind = rows;
+   createSetPackingSubMatrix(si, rowMap);
+   separateGraph(cs);
+}
+
+void
+CglClique::separateComponents(const OsiSolverInterface& si,
+			      const CglModelComponents& components,
+			      OsiCuts& cs)
+{
+   const int numberComponents = components.numberComponents();
+   const int* columnComponent = components.columnComponent();
+   const int* rowComponent = components.rowComponent();
+   int i;
+   // count selected columns and rows in each block
+   int* colStart = new int[numberComponents+1];
+   int* rowStart = new int[numberComponents+1];
+   std::fill(colStart, colStart + (numberComponents+1), 0);
+   std::fill(rowStart, rowStart + (numberComponents+1), 0);
+   for (i = 0; i < sp_numcols; ++i) {
+      const int iComponent = columnComponent[sp_orig_col_ind[i]];
+      if (iComponent >= 0)
+	 ++colStart[iComponent+1];
+   }
+   for (i = 0; i < sp_numrows; ++i) {
+      const int iComponent = rowComponent[sp_orig_row_ind[i]];
+      if (iComponent >= 0)
+	 ++rowStart[iComponent+1];
+   }
+   std::partial_sum(colStart, colStart+(numberComponents+1), colStart);
+   std::partial_sum(rowStart, rowStart+(numberComponents+1), rowStart);
+   // group (keeping order within block)
+   const int numberColumns = colStart[numberComponents];
+   const int numberRows = rowStart[numberComponents];
+   int* blockColumns = new int[numberColumns];
+   double* blockSolution = new double[numberColumns];
+   int* blockRows = new int[numberRows];
+   int* put = new int[numberComponents];
+   std::copy(colStart, colStart+numberComponents, put);
+   for (i = 0; i < sp_numcols; ++i) {
+      const int iComponent = columnComponent[sp_orig_col_ind[i]];
+      if (iComponent >= 0) {
+	 blockColumns[put[iComponent]] = sp_orig_col_ind[i];
+	 blockSolution[put[iComponent]++] = sp_colsol[i];
+      }
+   }
+   std::copy(rowStart, rowStart+numberComponents, put);
+   for (i = 0; i < sp_numrows; ++i) {
+      const int iComponent = rowComponent[sp_orig_row_ind[i]];
+      if (iComponent >= 0)
+	 blockRows[put[iComponent]++] = sp_orig_row_ind[i];
+   }
+   delete[] put;
+   // blocks worth separating
+   int* block = new int[numberComponents];
+   int numberBlocks = 0;
+   for (int iComponent = 0; iComponent < numberComponents; ++iComponent) {
+      const int nCols = colStart[iComponent+1] - colStart[iComponent];
+      const int nRows = rowStart[iComponent+1] - rowStart[iComponent];
+      if (nCols < 2 || !nRows || nCols > MAX_CGLCLIQUE_COLS)
+	 continue;
+      block[numberBlocks++] = iComponent;
+   }
+   // save full selection
+   int* saveColumns = sp_orig_col_ind;
+   double* saveSolution = sp_colsol;
+   int* saveRows = sp_orig_row_ind;
+   const int saveNumberColumns = sp_numcols;
+   const int saveNumberRows = sp_numrows;
+   int* rowMap = new int[si.getNumRows()];
+   std::fill(rowMap, rowMap+si.getNumRows(), -1);
+   for (i = 0; i < numberBlocks; ++i) {
+      const int iComponent = block[i];
+      separateBlock(si, colStart[iComponent+1] - colStart[iComponent],
+		    blockColumns + colStart[iComponent],
+		    blockSolution + colStart[iComponent],
+		    rowStart[iComponent+1] - rowStart[iComponent],
+		    blockRows + rowStart[iComponent], rowMap, cs);
+   }
+   delete[] rowMap;
+   sp_orig_col_ind = saveColumns;
+   sp_colsol = saveSolution;
+   sp_orig_row_ind = saveRows;
+   sp_numcols = saveNumberColumns;
+   sp_numrows = saveNumberRows;
+   delete[] block;
+   delete[] blockColumns;
+   delete[] blockSolution;
+   delete[] blockRows;
+   delete[] colStart;
+   delete[] rowStart;
 }
 
 /*****************************************************************************/
@@ -932,3 +1176,14 @@ CglFakeClique::generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
     CglClique::generateCuts(si,cs,info);
   }
 }
+// Generate cuts for several points - fake solver needs reduced costs of si
+void
+CglFakeClique::generateCutsMulti(const OsiSolverInterface& si, int numberPoints,
+				 const double * const * solutions,
+				 const double * const * lowers,
+				 const double * const * uppers,
+				 OsiCuts * cs, const CglTreeInfo info)
+{
+  CglCutGenerator::generateCutsMulti(si,numberPoints,solutions,lowers,
+				     uppers,cs,info);
+}
@@ -28,6 +28,19 @@ public:
     virtual void
     generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
 		 const CglTreeInfo info = CglTreeInfo());
+    /** Generate clique cuts for several points.  Rows which can be
+	cliques (upper bound 1, no negative elements), blocks and stored
+	cliques are found once.  Clique cuts do not depend on bounds so
+	lowers and uppers are not used and columns are binary as in si. */
+    virtual void
+    generateCutsMulti(const OsiSolverInterface& si, int numberPoints,
+		      const double * const * solutions,
+		      const double * const * lowers,
+		      const double * const * uppers,
+		      OsiCuts * cs, const CglTreeInfo info = CglTreeInfo());
+    /// Cuts only depend on solution and matrix
+    virtual bool needsOnlySolution() const
+    { return true; }
    
     /**@name Constructors and destructors */
     //@{
@@ -87,6 +100,14 @@ public:
     double getMinViolation() const { return petol; }
     /// Maximum number of binaries for looking at all
     inline void setMaxNumber(int value) { maxNumber_ = value; }
+    /** Use cliques stored by probing (CglTreeProbingInfo::setCliques) as
+	extra edges of the intersection graph.  Not owned; only used while
+	the number of variables matches the solver.  NULL switches off. */
+    inline void setProbingInfo(const CglTreeProbingInfo * info)
+    { probingInfo_ = info; }
+    /// Probing information used for stored cliques (or NULL)
+    inline const CglTreeProbingInfo * probingInfo() const
+    { return probingInfo_; }
 
 private:
 
@@ -160,6 +181,10 @@ protected:
     double petol;
     /// Maximum number of binaries for looking at all
     int maxNumber_; 
+    /// Stored cliques from probing (not owned)
+    const CglTreeProbingInfo * probingInfo_;
+    /// probingInfo_ if it fits model of current generateCuts, else NULL
+    const CglTreeProbingInfo * activeProbingInfo_;
 
     /** data for the star clique algorithm */
 
@@ -215,18 +240,53 @@ protected:
 
 private:
     /** Scan through the variables and select those that are binary and are at
-	a fractional level. */
-    void selectFractionalBinaries(const OsiSolverInterface& si);
+	a fractional level.  If digest is given (it must match si) then only
+	fractional variables are looked at.  If solution is given it is
+	used instead of solution of si (and digest must be NULL). */
+    void selectFractionalBinaries(const OsiSolverInterface& si,
+				  const CglSolutionDigest * digest = NULL,
+				  const double * solution = NULL);
     /** Scan through the variables and select those that are at a fractional
-	level. We already know that everything is binary. */
-    void selectFractionals(const OsiSolverInterface& si);
-    /**  */
-    void selectRowCliques(const OsiSolverInterface& si,int numOriginalRows);
-    /**  */
-    void createSetPackingSubMatrix(const OsiSolverInterface& si);
+	level. We already know that everything is binary.  Digest and
+	solution are used as in selectFractionalBinaries. */
+    void selectFractionals(const OsiSolverInterface& si,
+			   const CglSolutionDigest * digest = NULL,
+			   const double * solution = NULL);
+    /** Marks rows which can be cliques whatever the solution - upper
+	bound 1, no negative elements and before numOriginalRows */
+    void markPossibleRowCliques(const OsiSolverInterface& si,
+				int numOriginalRows, char * possible) const;
+    /** Selects rows which are cliques for selected columns.  If possible
+	is given (see markPossibleRowCliques) row bounds and elements are
+	not looked at again. */
+    void selectRowCliques(const OsiSolverInterface& si,int numOriginalRows,
+			  const char * possible = NULL);
+    /** Separates cliques for selected columns and rows and then deletes
+	selection.  Returns false (and does nothing) if too many rows or
+	too few columns. */
+    bool separateSelected(const OsiSolverInterface& si,
+			  const CglModelComponents * components,
+			  OsiCuts& cs, const CglTreeInfo& info);
+    /** If rowMap given it must be all -1 (size of number of rows in si)
+	and is left that way. */
+    void createSetPackingSubMatrix(const OsiSolverInterface& si,
+				   int* rowMap = NULL);
+    /** Build graph for current submatrix and separate cliques in it */
+    void separateGraph(OsiCuts& cs);
+    /** Split selected columns and rows by independent block (as given
+	by CglTreeInfo::components) and separate each block in turn. */
+    void separateComponents(const OsiSolverInterface& si,
+			    const CglModelComponents& components,
+			    OsiCuts& cs);
+    /** Separate one block given by its columns (with solution values) and
+	rows.  rowMap as for createSetPackingSubMatrix. */
+    void separateBlock(const OsiSolverInterface& si,
+		       int numberColumns, int* columns, double* solution,
+		       int numberRows, int* rows, int* rowMap, OsiCuts& cs);
     /**  */
     void createFractionalGraph();
-    /**  */
+    /** Edges are pairs of columns in a selected row or (if
+	activeProbingInfo_) in a stored clique */
     int createNodeNode();
     /**  */
     void deleteSetPackingSubMatrix();
@@ -279,6 +339,17 @@ public:
   virtual void
   generateCuts(const OsiSolverInterface& si, OsiCuts & cs,
 	       const CglTreeInfo info = CglTreeInfo());
+  /** Generate cuts for several points - as fake solver takes reduced
+      costs from si only current point of si is used */
+  virtual void
+  generateCutsMulti(const OsiSolverInterface& si, int numberPoints,
+		    const double * const * solutions,
+		    const double * const * lowers,
+		    const double * const * uppers,
+		    OsiCuts * cs, const CglTreeInfo info = CglTreeInfo());
+  /// Uses reduced costs of si
+  virtual bool needsOnlySolution() const
+  { return false; }
   
   /**@name Constructors and destructors */
   //@{
@@ -4,10 +4,12 @@
 
 #include <numeric>
 #include <cassert>
+#include <algorithm>
 
 #include "CoinPackedMatrix.hpp"
 #include "OsiSolverInterface.hpp"
 #include "CglClique.hpp"
+#include "CglSolutionDigest.hpp"
 
 /*****************************************************************************/
 
@@ -16,7 +18,9 @@
   fractional level.
  *===========================================================================*/
 void
-CglClique::selectFractionalBinaries(const OsiSolverInterface& si)
+CglClique::selectFractionalBinaries(const OsiSolverInterface& si,
+				    const CglSolutionDigest * digest,
+				    const double * solution)
 {
    // extract the primal tolerance from the solver
    double lclPetol = 0.0;
@@ -33,12 +37,25 @@ CglClique::selectFractionalBinaries(const OsiSolverInterface& si)
      if (n<maxNumber_)
        lclPetol=-1.0e-5;
    }
-   const double* x = si.getColSolution();
+   const double* x = solution ? solution : si.getColSolution();
    std::vector<int> fracind;
    int i;
-   for (i = 0; i < numcols; ++i) {
-      if (si.isBinary(i) && x[i] > lclPetol && x[i] < 1-petol)
-	 fracind.push_back(i);
+   double tolerance = CoinMin(lclPetol, petol);
+   if (digest && tolerance >= digest->integerTolerance()) {
+      // only need to look at fractional ones - keep in column order
+      const int * fractional = digest->fractional();
+      int numberFractional = digest->numberFractional(tolerance);
+      for (int k = 0; k < numberFractional; ++k) {
+	 i = fractional[k];
+	 if (si.isBinary(i) && x[i] > lclPetol && x[i] < 1-petol)
+	    fracind.push_back(i);
+      }
+      std::sort(fracind.begin(), fracind.end());
+   } else {
+      for (i = 0; i < numcols; ++i) {
+	 if (si.isBinary(i) && x[i] > lclPetol && x[i] < 1-petol)
+	    fracind.push_back(i);
+      }
    }
    sp_numcols = static_cast<int>(fracind.size());
    sp_orig_col_ind = new int[sp_numcols];
@@ -57,19 +74,29 @@ CglClique::selectFractionalBinaries(const OsiSolverInterface& si)
  *===========================================================================*/
 
 void
-CglClique::selectFractionals(const OsiSolverInterface& si)
+CglClique::selectFractionals(const OsiSolverInterface& si,
+			     const CglSolutionDigest * digest,
+			     const double * solution)
 {
    // extract the primal tolerance from the solver
    double lclPetol = 0.0;
    si.getDblParam(OsiPrimalTolerance, lclPetol);
 
    const int numcols = si.getNumCols();
-   const double* x = si.getColSolution();
+   const double* x = solution ? solution : si.getColSolution();
    std::vector<int> fracind;
    int i;
-   for (i = 0; i < numcols; ++i) {
-      if (x[i] > lclPetol && x[i] < 1-lclPetol)
-	 fracind.push_back(i);
+   if (digest && lclPetol >= digest->integerTolerance()) {
+      // everything is binary so fractional list is all we need
+      const int * fractional = digest->fractional();
+      int numberFractional = digest->numberFractional(lclPetol);
+      fracind.assign(fractional, fractional + numberFractional);
+      std::sort(fracind.begin(), fracind.end());
+   } else {
+      for (i = 0; i < numcols; ++i) {
+	 if (x[i] > lclPetol && x[i] < 1-lclPetol)
+	    fracind.push_back(i);
+      }
    }
    sp_numcols = static_cast<int>(fracind.size());
    sp_orig_col_ind = new int[sp_numcols];
@@ -86,7 +113,36 @@ CglClique::selectFractionals(const OsiSolverInterface& si)
  *===========================================================================*/
 
 void
-CglClique::selectRowCliques(const OsiSolverInterface& si,int numOriginalRows)
+CglClique::markPossibleRowCliques(const OsiSolverInterface& si,
+				  int numOriginalRows, char * possible) const
+{
+   const int numrows = si.getNumRows();
+   const CoinPackedMatrix& mrow = *si.getMatrixByRow();
+   const double* rub = si.getRowUpper();
+   for (int i = 0; i < numrows; ++i) {
+      possible[i] = 0;
+      if (rub[i] != 1.0||i>=numOriginalRows)
+	 continue;
+      const CoinShallowPackedVector& vec = mrow.getVector(i);
+      const double* elem = vec.getElements();
+      int j;
+      for (j = vec.getNumElements() - 1; j >= 0; --j) {
+	 if (elem[j] < 0)
+	    break;
+      }
+      if (j < 0)
+	 possible[i] = 1;
+   }
+}
+
+/*****************************************************************************/
+
+/*===========================================================================*
+ *===========================================================================*/
+
+void
+CglClique::selectRowCliques(const OsiSolverInterface& si,int numOriginalRows,
+			    const char * possible)
 {
    const int numrows = si.getNumRows();
 #ifndef INTEL_COMPILER
@@ -112,21 +168,28 @@ CglClique::selectRowCliques(const OsiSolverInterface& si,int numOriginalRows)
    }
 
    // Now check the sense and rhs (by checking rowupper) and the rest of the
-   // coefficients 
-   const CoinPackedMatrix& mrow = *si.getMatrixByRow();
-   const double* rub = si.getRowUpper();
-   for (i = 0; i < numrows; ++i) {
-      if (rub[i] != 1.0||i>=numOriginalRows) {
-	 clique[i] = 0;
-	 continue;
+   // coefficients (unless already done)
+   if (possible) {
+      for (i = 0; i < numrows; ++i) {
+	 if (!possible[i])
+	    clique[i] = 0;
       }
-      if (clique[i] == 1) {
-	 const CoinShallowPackedVector& vec = mrow.getVector(i);
-	 const double* elem = vec.getElements();
-	 for (j = vec.getNumElements() - 1; j >= 0; --j) {
-	    if (elem[j] < 0) {
-	       clique[i] = 0;
-	       break;
+   } else {
+      const CoinPackedMatrix& mrow = *si.getMatrixByRow();
+      const double* rub = si.getRowUpper();
+      for (i = 0; i < numrows; ++i) {
+	 if (rub[i] != 1.0||i>=numOriginalRows) {
+	    clique[i] = 0;
+	    continue;
+	 }
+	 if (clique[i] == 1) {
+	    const CoinShallowPackedVector& vec = mrow.getVector(i);
+	    const double* elem = vec.getElements();
+	    for (j = vec.getNumElements() - 1; j >= 0; --j) {
+	       if (elem[j] < 0) {
+		  clique[i] = 0;
+		  break;
+	       }
 	    }
 	 }
       }
@@ -148,7 +211,8 @@ CglClique::selectRowCliques(const OsiSolverInterface& si,int numOriginalRows)
   Create the set packing submatrix
  *===========================================================================*/
 void
-CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si)
+CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si,
+				     int* rowMap)
 {
    sp_col_start = new int[sp_numcols+1];
    sp_row_start = new int[sp_numrows+1];
@@ -158,9 +222,12 @@ CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si)
    int i, j;
 
    const CoinPackedMatrix& mcol = *si.getMatrixByCol();
-   const int numrows = si.getNumRows();
-   int* clique = new int[numrows];
-   std::fill(clique, clique+numrows, -1);
+   int* clique = rowMap;
+   if (!rowMap) {
+      const int numrows = si.getNumRows();
+      clique = new int[numrows];
+      std::fill(clique, clique+numrows, -1);
+   }
    for (i = 0; i < sp_numrows; ++i)
       clique[sp_orig_row_ind[i]] = i;
 
@@ -230,7 +297,13 @@ CglClique::createSetPackingSubMatrix(const OsiSolverInterface& si)
 	       sp_row_start + (sp_numrows+1));
    sp_row_start[0] = 0;
 
-   delete[] clique;
+   if (!rowMap) {
+      delete[] clique;
+   } else {
+      // leave as found
+      for (i = 0; i < sp_numrows; ++i)
+	 clique[sp_orig_row_ind[i]] = -1;
+   }
 }
 
 /*****************************************************************************/
@@ -340,6 +413,45 @@ CglClique::createNodeNode()
 	 }
       }
    }
+   if (activeProbingInfo_) {
+      /* Two columns which are both at one in a clique found by probing
+	 can not both be one.  Only entries where oneFixes is true are
+	 literals x (others are 1-x) so only those give edges. */
+      int numberColumns = activeProbingInfo_->numberVariables();
+      int * spIndex = new int[numberColumns];
+      std::fill(spIndex, spIndex + numberColumns, -1);
+      for (i = 0; i < sp_numcols; ++i)
+	 spIndex[sp_orig_col_ind[i]] = i;
+      const int * integerVariable = activeProbingInfo_->integerVariable();
+      const CoinBigIndex * cliqueStart = activeProbingInfo_->cliqueStart();
+      const CliqueEntry * entry = activeProbingInfo_->cliqueEntry();
+      for (i = 0; i < sp_numcols; ++i) {
+	 const int * which;
+	 int n = activeProbingInfo_->cliquesOf(sp_orig_col_ind[i], which);
+	 for (int k = 0; k < n; ++k) {
+	    int iClique = which[k];
+	    CoinBigIndex m;
+	    for (m = cliqueStart[iClique]; m < cliqueStart[iClique+1]; ++m) {
+	       if (integerVariable[sequenceInCliqueEntry(entry[m])] ==
+		   sp_orig_col_ind[i])
+		  break;
+	    }
+	    if (m == cliqueStart[iClique+1] || !oneFixesInCliqueEntry(entry[m]))
+	       continue; // 1-x in this clique
+	    for (m = cliqueStart[iClique]; m < cliqueStart[iClique+1]; ++m) {
+	       if (!oneFixesInCliqueEntry(entry[m]))
+		  continue;
+	       j = spIndex[integerVariable[sequenceInCliqueEntry(entry[m])]];
+	       if (j > i && !node_node[i * sp_numcols + j]) {
+		  node_node[i * sp_numcols + j] = true;
+		  node_node[j * sp_numcols + i] = true;
+		  ++edgenum;
+	       }
+	    }
+	 }
+      }
+      delete[] spIndex;
+   }
    return edgenum;
 }
 
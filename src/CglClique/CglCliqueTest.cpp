@@ -11,7 +11,10 @@
 
 #include <cassert>
 #include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
 #include "CglClique.hpp"
+#include "CglModelComponents.hpp"
+#include "CglSolutionDigest.hpp"
 
 
 void
@@ -39,6 +42,83 @@ CglCliqueUnitTest(const OsiSolverInterface *baseSiP,
     // None to test
   }
 
+  // Test independent blocks - two triangles with edge rows
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    int start[7] = { 0, 2, 4, 6, 8, 10, 12 };
+    int row[12] = { 0, 2, 0, 1, 1, 2, 3, 5, 3, 4, 4, 5 };
+    double element[12] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+                           1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    double columnLower[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+    double columnUpper[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    double objective[6] = { -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 };
+    double rowLower[6] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX,
+                           -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX };
+    double rowUpper[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    CoinPackedMatrix matrix(true, 6, 6, 12, element, row, start, NULL);
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+                     rowLower, rowUpper);
+    for (int i = 0; i < 6; i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    CglModelComponents components(*siP);
+    assert(components.numberComponents() == 2);
+    CglClique gct;
+    OsiCuts cs;
+    gct.generateCuts(*siP, cs);
+    CglTreeInfo info;
+    info.components = &components;
+    OsiCuts cs2;
+    gct.generateCuts(*siP, cs2, info);
+    assert(cs2.sizeRowCuts() == cs.sizeRowCuts());
+    assert(cs2.sizeRowCuts() >= 2);
+    delete siP;
+  }
+
+  // Test cliques stored by probing - x0,x2 only in 2x0+2x2<=3
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    int row[6] = { 0, 0, 1, 1, 2, 2 };
+    int column[6] = { 0, 1, 1, 2, 0, 2 };
+    double element[6] = { 1.0, 1.0, 1.0, 1.0, 2.0, 2.0 };
+    CoinPackedMatrix matrix(false, row, column, element, 6);
+    double columnLower[3] = { 0.0, 0.0, 0.0 };
+    double columnUpper[3] = { 1.0, 1.0, 1.0 };
+    double objective[3] = { -1.0, -1.0, -1.0 };
+    double rowLower[3] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX };
+    double rowUpper[3] = { 1.0, 1.0, 3.0 };
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+                     rowLower, rowUpper);
+    for (int i = 0; i < 3; i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    CglClique gct;
+    OsiCuts cs;
+    gct.generateCuts(*siP, cs);
+    for (int i = 0; i < cs.sizeRowCuts(); i++)
+      assert(cs.rowCut(i).row().getNumElements() < 3);
+    CglTreeProbingInfo info(siP);
+    info.initializeFixing(siP);
+    CoinBigIndex start[2] = { 0, 2 };
+    CliqueEntry entries[2];
+    for (int i = 0; i < 2; i++) {
+      entries[i].fixes = 0;
+      setSequenceInCliqueEntry(entries[i], 2 * i);
+      setOneFixesInCliqueEntry(entries[i], true);
+    }
+    info.setCliques(1, start, entries);
+    gct.setProbingInfo(&info);
+    OsiCuts cs2;
+    gct.generateCuts(*siP, cs2);
+    bool found = false;
+    for (int i = 0; i < cs2.sizeRowCuts(); i++) {
+      if (cs2.rowCut(i).row().getNumElements() == 3)
+        found = true;
+    }
+    assert(found);
+    delete siP;
+  }
+
   // Test generateCuts
   {
     CglClique gct;
@@ -61,6 +141,43 @@ CglCliqueUnitTest(const OsiSolverInterface *baseSiP,
       int nRowCuts = cs.sizeRowCuts();
       std::cout<<"There are "<<nRowCuts<<" Clique cuts"<<std::endl;
       assert(cs.sizeRowCuts() > 0);
+      // same cuts if fractional variables come from a shared digest
+      {
+        CglTreeInfo info;
+        CglSolutionDigest digest(*siP, info);
+        assert(digest.matches(*siP, info));
+        info.solutionDigest = &digest;
+        OsiCuts cs2;
+        gct.generateCuts(*siP, cs2, info);
+        assert(cs2.sizeRowCuts() == nRowCuts);
+      }
+      // same cuts for several points as from generateCuts on each -
+      // second point has a fractional binary down
+      {
+        int nCols = siP->getNumCols();
+        const double * x = siP->getColSolution();
+        int iColumn;
+        for (iColumn = 0; iColumn < nCols; iColumn++) {
+          if (siP->isBinary(iColumn) && x[iColumn] > 1.0e-4 &&
+              x[iColumn] < 1.0 - 1.0e-4)
+            break;
+        }
+        assert(iColumn < nCols);
+        OsiSolverInterface * child = siP->clone();
+        child->setColUpper(iColumn, 0.0);
+        child->resolve();
+        const double * solutions[2] = { x, child->getColSolution() };
+        const double * uppers[2] = { NULL, child->getColUpper() };
+        OsiCuts csMulti[2];
+        gct.generateCutsMulti(*siP, 2, solutions, NULL, uppers, csMulti);
+        OsiCuts csChild;
+        gct.generateCuts(*child, csChild);
+        assert(csMulti[0].sizeRowCuts() == nRowCuts);
+        assert(csMulti[1].sizeRowCuts() == csChild.sizeRowCuts());
+        for (int i = 0; i < csChild.sizeRowCuts(); i++)
+          assert(csMulti[1].rowCut(i) == csChild.rowCut(i));
+        delete child;
+      }
       OsiSolverInterface::ApplyCutsReturnCode rc = siP->applyCuts(cs);
       
       siP->resolve();
@@ -303,13 +303,16 @@ void CglCliqueStrengthening::cliqueExtension(size_t extMethod, CoinCliqueSet *ne
   bool *ivCol = (bool*)xcalloc(numCols * 2, sizeof(bool));
   char name[256];
 
-  // filling reduced costs
-  double *rc = getReducedCost();
+  // filling reduced costs (only needed by methods 4 and 5)
+  double *rc = NULL;
+  if (extMethod == 4 || extMethod == 5) {
+    rc = getReducedCost();
 
-  // if reduced costs are not available, change the
-  // extension method
-  if (rc == NULL && (extMethod == 4 || extMethod == 5)) {
-    extMethod = 2;
+    // if reduced costs are not available, change the
+    // extension method
+    if (rc == NULL) {
+      extMethod = 2;
+    }
   }
 
   CoinCliqueExtender clqe(cgraph_, extMethod, rc);
@@ -359,13 +362,15 @@ void CglCliqueStrengthening::cliqueExtension(size_t extMethod, CoinCliqueSet *ne
   bool *ivCol = (bool*)xcalloc(numCols * 2, sizeof(bool));
   char name[256];
 
-  // filling reduced costs
-  double *rc = getReducedCost();
+  // filling reduced costs (only needed by methods 4 and 5)
+  double *rc = NULL;
 
   // if reduced costs are not available, change the
   // extension method
-  if (rc == NULL) {
+  if (!model_->isProvenOptimal()) {
     extMethod = 2;
+  } else if (extMethod == 4 || extMethod == 5) {
+    rc = getReducedCost();
   }
 
   CoinCliqueExtender clqe(cgraph_, extMethod, rc);
@@ -477,9 +482,12 @@ void CglCliqueStrengthening::checkDominance(const size_t *extClqEl, size_t extCl
     ivCol[extClqEl[i]] = false;
   }
 
-  //clearing ivRow
-  for (size_t i = 0; i < cliqueRows_->rows(); i++) {
-    ivRow[i] = false;
+  //clearing ivRow (only rows of cliques containing the columns above)
+  for (size_t i = 0; i < extClqSize; i++) {
+    const size_t col = extClqEl[i];
+    for (size_t j = 0; j < nColClqs_[col]; j++) {
+      ivRow[colClqs_[col][j]] = false;
+    }
   }
 }
 
@@ -509,6 +517,7 @@ void CglCliqueStrengthening::addStrongerCliques(const CoinCliqueSet *newCliques)
 
   int *nrIdx = (int*)xmalloc(sizeof(int) * newCliques->totalElements());
   int *idxMap = (int*)xmalloc(sizeof(int) * numCols);//controls duplicated indexes (var and complement)
+  std::fill(idxMap, idxMap + numCols, -1);
   double *nrCoef = (double*)xmalloc(sizeof(double) * newCliques->totalElements());
   CoinBigIndex *nrStart = (CoinBigIndex*)xmalloc(sizeof(CoinBigIndex) * (nCliques + 1)); nrStart[0] = 0;
   double *nrLB = (double*)xmalloc(sizeof(double) * nCliques);
@@ -520,8 +529,6 @@ void CglCliqueStrengthening::addStrongerCliques(const CoinCliqueSet *newCliques)
     double rhs = 1.0;
     size_t duplicated = 0;
 
-    std::fill(idxMap, idxMap + numCols, -1);
-
     for (size_t i = 0; i < extClqSize; i++) {
       if (extClqEl[i] < numCols) {
         if(idxMap[extClqEl[i]] == -1) {
@@ -570,6 +577,11 @@ void CglCliqueStrengthening::addStrongerCliques(const CoinCliqueSet *newCliques)
       rowClqNames_[ic] = name;
     }
 
+    //resetting only the positions used by this clique
+    for (size_t i = 0; i < extClqSize; i++) {
+      idxMap[extClqEl[i] < numCols ? extClqEl[i] : extClqEl[i] - numCols] = -1;
+    }
+
     nrLB[ic] = -DBL_MAX;
     nrUB[ic] = rhs;
     nrStart[ic + 1] = numVars;
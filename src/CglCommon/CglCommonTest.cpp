@@ -0,0 +1,333 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "OsiRowCut.hpp"
+#include "CglCutGenerator.hpp"
+#include "CglSolutionDigest.hpp"
+#include "CglModelComponents.hpp"
+#include "CglImpliedIntegers.hpp"
+#include "CglSeparationCache.hpp"
+#include "CglFixedColumnCompression.hpp"
+
+// Generator which counts calls and gives x0 + x1 <= 1
+class CglCommonTestGenerator : public CglCutGenerator {
+public:
+  CglCommonTestGenerator()
+    : numberCalls_(0)
+  {
+  }
+  virtual void generateCuts(const OsiSolverInterface &, OsiCuts &cs,
+    const CglTreeInfo = CglTreeInfo())
+  {
+    numberCalls_++;
+    int index[2] = { 0, 1 };
+    double element[2] = { 1.0, 1.0 };
+    OsiRowCut rc;
+    rc.setRow(2, index, element, false);
+    rc.setLb(-COIN_DBL_MAX);
+    rc.setUb(1.0);
+    cs.insert(rc);
+  }
+  virtual CglCutGenerator *clone() const
+  {
+    return new CglCommonTestGenerator(*this);
+  }
+  virtual bool needsOnlySolution() const
+  {
+    return true;
+  }
+  int numberCalls_;
+};
+
+// As above but says it needs an optimal basis
+class CglCommonTestBasisGenerator : public CglCommonTestGenerator {
+public:
+  virtual CglCutGenerator *clone() const
+  {
+    return new CglCommonTestBasisGenerator(*this);
+  }
+  virtual bool needsOptimalBasis() const
+  {
+    return true;
+  }
+  virtual bool needsOnlySolution() const
+  {
+    return false;
+  }
+};
+
+// Generator which only gives x0 + x1 <= 1 if x0 or x1 has a reduced cost
+class CglCommonTestReducedCostGenerator : public CglCommonTestGenerator {
+public:
+  virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+    const CglTreeInfo info = CglTreeInfo())
+  {
+    const double *dj = si.getReducedCost();
+    if (dj[0] || dj[1])
+      CglCommonTestGenerator::generateCuts(si, cs, info);
+    else
+      numberCalls_++;
+  }
+  virtual CglCutGenerator *clone() const
+  {
+    return new CglCommonTestReducedCostGenerator(*this);
+  }
+  virtual bool needsOnlySolution() const
+  {
+    return false;
+  }
+};
+
+void CglCommonUnitTest(const OsiSolverInterface *baseSiP,
+  const std::string mpsDir)
+{
+  // Test implied integers
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    // x0 - y = 0, y + z = 3, x0 + w <= 4, x0 + 0.5v <= 4 with x0 integer
+    int start[6] = { 0, 3, 5, 6, 7, 8 };
+    int row[8] = { 0, 2, 3, 0, 1, 1, 2, 3 };
+    double element[8] = { 1.0, 1.0, 1.0, -1.0, 1.0, 1.0, 1.0, 0.5 };
+    double columnLower[5] = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    double columnUpper[5] = { 5.0, 10.0, 10.0, 10.0, 10.0 };
+    double objective[5] = { -1.0, 0.0, 0.0, -1.0, -1.0 };
+    double rowLower[4] = { 0.0, 3.0, -COIN_DBL_MAX, -COIN_DBL_MAX };
+    double rowUpper[4] = { 0.0, 3.0, 4.0, 4.0 };
+    CoinPackedMatrix matrix(true, 4, 5, 8, element, row, start, NULL);
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    siP->setInteger(0);
+    CglImpliedIntegers implied(*siP);
+    const char *status = implied.status();
+    assert(status[0] == 1);
+    assert(status[1] == 2);
+    assert(status[2] == 2);
+    assert(status[3] == 3);
+    assert(status[4] == 3);
+    assert(implied.numberImplied() == 4);
+    assert(implied.isInteger(1, 0.0, 10.0));
+    // x4 is only integral in some optimal solution
+    assert(!implied.isInteger(4, 0.0, 10.0));
+    implied.setAllowWeak(true);
+    assert(implied.isInteger(4, 0.0, 10.0));
+    assert(!implied.isInteger(4, 0.0, 9.5));
+    CglImpliedIntegers justEquality(*siP, 1);
+    assert(justEquality.numberImplied() == 2);
+    assert(!justEquality.isInteger(3, 0.0, 10.0));
+    delete siP;
+  }
+
+  // Two triangles x(i) + x(j) <= 1 - LP solution is all 0.5
+  int start[7] = { 0, 2, 4, 6, 8, 10, 12 };
+  int row[12] = { 0, 2, 0, 1, 1, 2, 3, 5, 3, 4, 4, 5 };
+  double element[12] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0,
+    1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+  double columnLower[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+  double columnUpper[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+  double objective[6] = { -1.0, -1.0, -1.0, -1.0, -1.0, -1.0 };
+  double rowLower[6] = { -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX,
+    -COIN_DBL_MAX, -COIN_DBL_MAX, -COIN_DBL_MAX };
+  double rowUpper[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+  CoinPackedMatrix matrix(true, 6, 6, 12, element, row, start, NULL);
+
+  // Test model components
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    CglModelComponents components(*siP);
+    assert(components.numberComponents() == 2);
+    assert(components.columnComponent()[2] == 0);
+    assert(components.columnComponent()[3] == 1);
+    assert(components.rowComponent()[5] == 1);
+    assert(components.numberRows(0) == 3);
+    assert(components.numberColumns(1) == 3);
+    // joining blocks gives one component
+    int index[2] = { 2, 3 };
+    double value[2] = { 1.0, 1.0 };
+    siP->addRow(2, index, value, -COIN_DBL_MAX, 1.0);
+    components.compute(*siP);
+    assert(components.numberComponents() == 1);
+    assert(components.numberRows(0) == 7);
+    delete siP;
+  }
+
+  // Test solution digest
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    for (int i = 0; i < 6; i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    CglTreeInfo info;
+    info.pass = 0;
+    CglSolutionDigest digest(*siP, info);
+    assert(digest.numberFractional() == 6);
+    assert(digest.matches(*siP, info));
+    const int *fractional = digest.fractional();
+    const double *away = digest.fractionality();
+    for (int i = 1; i < digest.numberFractional(); i++)
+      assert(away[fractional[i - 1]] >= away[fractional[i]]);
+    info.solutionDigest = &digest;
+    assert(!CglSolutionDigest::noneFractional(*siP, info, 0.4));
+    assert(CglSolutionDigest::noneFractional(*siP, info, 0.5));
+    // not for another pass
+    info.pass = 1;
+    assert(!digest.matches(*siP, info));
+    assert(!CglSolutionDigest::noneFractional(*siP, info, 0.5));
+    // nor for a new solution
+    info.pass = 0;
+    siP->setColUpper(0, 0.25);
+    siP->resolve();
+    assert(!digest.matches(*siP, info));
+    digest.compute(*siP, info);
+    assert(digest.matches(*siP, info));
+    delete siP;
+  }
+
+  // Test separation cache
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    siP->initialSolve();
+    CglCommonTestGenerator gen;
+    CglCachedCutGenerator cached(gen, 2);
+    const CglCommonTestGenerator *inside = dynamic_cast< const CglCommonTestGenerator * >(cached.generator());
+    assert(inside);
+    CglTreeInfo info;
+    OsiCuts cs;
+    cached.generateCuts(*siP, cs, info);
+    OsiCuts cs2;
+    cached.generateCuts(*siP, cs2, info);
+    assert(inside->numberCalls_ == 1);
+    assert(cached.separationCache().numberHits() == 1);
+    // same cuts as without cache
+    OsiCuts cs0;
+    gen.generateCuts(*siP, cs0, info);
+    assert(cs.sizeRowCuts() == cs0.sizeRowCuts());
+    assert(cs2.sizeRowCuts() == cs0.sizeRowCuts());
+    for (int i = 0; i < cs0.sizeRowCuts(); i++) {
+      assert(cs.rowCut(i) == cs0.rowCut(i));
+      assert(cs2.rowCut(i) == cs0.rowCut(i));
+    }
+    // cuts already in cs are kept and not compared against
+    cached.generateCuts(*siP, cs2, info);
+    assert(cs2.sizeRowCuts() == 2 * cs0.sizeRowCuts());
+    // another pass is not taken from cache
+    info.pass = 1;
+    OsiCuts cs3;
+    cached.generateCuts(*siP, cs3, info);
+    assert(inside->numberCalls_ == 2);
+    // nor is a changed coefficient with same number of elements
+    double *saveSolution = CoinCopyOfArray(siP->getColSolution(), 6);
+    element[0] = 2.0;
+    CoinPackedMatrix matrix2(true, 6, 6, 12, element, row, start, NULL);
+    siP->loadProblem(matrix2, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    siP->setColSolution(saveSolution);
+    OsiCuts cs4;
+    cached.generateCuts(*siP, cs4, info);
+    assert(inside->numberCalls_ == 3);
+    assert(cached.separationCache().numberEntries() == 2);
+    // copy has own generator and results
+    CglCachedCutGenerator *copy = dynamic_cast< CglCachedCutGenerator * >(cached.clone());
+    assert(copy && copy->generator() != cached.generator());
+    assert(copy->separationCache().numberEntries() == 2);
+    copy->clearCache();
+    assert(!copy->separationCache().numberEntries());
+    delete copy;
+    delete[] saveSolution;
+    delete siP;
+  }
+
+  // Test several points - generator needing basis or reduced costs
+  // only gets current one
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    siP->initialSolve();
+    double otherSolution[6] = { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 };
+    double otherUpper[6] = { 1.0, 1.0, 0.0, 1.0, 1.0, 0.0 };
+    const double *solutions[2] = { siP->getColSolution(), otherSolution };
+    const double *uppers[2] = { NULL, otherUpper };
+    CglCommonTestGenerator gen;
+    OsiCuts cs[2];
+    gen.generateCutsMulti(*siP, 2, solutions, NULL, uppers, cs);
+    assert(gen.numberCalls_ == 2);
+    assert(cs[0].sizeRowCuts() == 1);
+    assert(cs[1].sizeRowCuts() == 1);
+    CglCommonTestBasisGenerator basisGen;
+    OsiCuts cs2[2];
+    basisGen.generateCutsMulti(*siP, 2, solutions, NULL, uppers, cs2);
+    assert(basisGen.numberCalls_ == 1);
+    assert(cs2[0].sizeRowCuts() == 1);
+    assert(cs2[1].sizeRowCuts() == 0);
+    // reduced costs of copy would be those of si - so no call for point
+    CglCommonTestReducedCostGenerator djGen;
+    OsiCuts cs3[2];
+    djGen.generateCutsMulti(*siP, 2, solutions, NULL, uppers, cs3);
+    assert(djGen.numberCalls_ == 1);
+    assert(cs3[1].sizeRowCuts() == 0);
+    // nor through cache
+    CglCachedCutGenerator cached(djGen);
+    OsiCuts cs4[2];
+    cached.generateCutsMulti(*siP, 2, solutions, NULL, uppers, cs4);
+    assert(cs4[0].sizeRowCuts() == cs3[0].sizeRowCuts());
+    assert(cs4[1].sizeRowCuts() == 0);
+    delete siP;
+  }
+
+  // Test compression - x2 to x5 fixed so compact model is x0 + x1 <= 1
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    siP->initialSolve();
+    siP->setColUpper(2, 0.0);
+    siP->setColUpper(3, 0.0);
+    siP->setColUpper(4, 0.0);
+    siP->setColUpper(5, 0.0);
+    siP->resolve();
+    CglFixedColumnCompression compression;
+    assert(compression.compress(*siP, 0.5) == 2);
+    const OsiSolverInterface *compact = compression.solver();
+    assert(compact->getNumCols() == 2);
+    assert(compression.originalColumns()[1] == 1);
+    // not solved - no cutoff to use with reduced costs
+    double limit;
+    compact->getDblParam(OsiDualObjectiveLimit, limit);
+    assert(limit >= 1.0e50);
+    assert(compact->getRowPrice()[0] == 0.0);
+    CglCommonTestGenerator gen;
+    OsiCuts cs;
+    compression.generateCuts(gen, cs);
+    assert(gen.numberCalls_ == 1);
+    assert(cs.sizeRowCuts() == 1);
+    const OsiRowCut &rc = cs.rowCut(0);
+    assert(!rc.globallyValid());
+    assert(rc.row().getIndices()[1] == 1);
+    // generator which needs basis is not called
+    CglCommonTestBasisGenerator basisGen;
+    OsiCuts cs2;
+    compression.generateCuts(basisGen, cs2);
+    assert(basisGen.numberCalls_ == 0);
+    assert(cs2.sizeRowCuts() == 0);
+    delete siP;
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
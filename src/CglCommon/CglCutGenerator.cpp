@@ -62,6 +62,40 @@ CglCutGenerator::operator=(
   }
   return *this;
 }
+// Generate cuts for several points
+void CglCutGenerator::generateCutsMulti(const OsiSolverInterface &si,
+  int numberPoints, const double *const *solutions,
+  const double *const *lowers, const double *const *uppers,
+  OsiCuts *cs, const CglTreeInfo info)
+{
+  OsiSolverInterface *copy = NULL;
+  const int numberColumns = si.getNumCols();
+  for (int i = 0; i < numberPoints; i++) {
+    const double *lower = (lowers && lowers[i]) ? lowers[i] : si.getColLower();
+    const double *upper = (uppers && uppers[i]) ? uppers[i] : si.getColUpper();
+    if (!copy && solutions[i] == si.getColSolution()
+      && lower == si.getColLower() && upper == si.getColUpper()) {
+      // point is current state of si
+      generateCuts(si, cs[i], info);
+      continue;
+    }
+    // copy would keep duals, activities and basis of si - not of this point
+    if (!needsOnlySolution())
+      continue;
+    // one copy for all points - only solution and changed bounds are set
+    if (!copy)
+      copy = si.clone();
+    const double *copyLower = copy->getColLower();
+    const double *copyUpper = copy->getColUpper();
+    for (int j = 0; j < numberColumns; j++) {
+      if (lower[j] != copyLower[j] || upper[j] != copyUpper[j])
+        copy->setColBounds(j, lower[j], upper[j]);
+    }
+    copy->setColSolution(solutions[i]);
+    generateCuts(*copy, cs[i], info);
+  }
+  delete copy;
+}
 bool CglCutGenerator::mayGenerateRowCutsInTree() const
 {
   return true;
@@ -71,6 +105,11 @@ bool CglCutGenerator::needsOptimalBasis() const
 {
   return false;
 }
+// Return true if cuts only depend on solution, bounds and matrix
+bool CglCutGenerator::needsOnlySolution() const
+{
+  return false;
+}
 bool CglCutGenerator::needsOriginalModel() const
 {
   return false;
@@ -33,6 +33,25 @@ public:
   virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
     const CglTreeInfo info = CglTreeInfo())
     = 0;
+  /** Generate cuts for several points at once (e.g. LP optimum,
+      heuristic solutions and strong branching children).
+      Point i has column solution solutions[i] and, if lowers (uppers)
+      and lowers[i] (uppers[i]) are not NULL, those column bounds -
+      otherwise bounds of si are used.  Cuts for point i are added to cs[i].
+      Default is to call generateCuts on si for a point which is the
+      current state of si (solutions[i] is si.getColSolution() and bounds
+      are those of si).  Other points are put in turn on one copy of si
+      but only the solution and bounds of the copy are changed - its
+      duals, reduced costs, row activities, objective value and basis are
+      still those of si.  So other points are only used if
+      needsOnlySolution() is true, otherwise cs[i] is left empty.
+      Generators which can share work between points (row
+      classification, derived rows etc) should override this.
+  */
+  virtual void generateCutsMulti(const OsiSolverInterface &si,
+    int numberPoints, const double *const *solutions,
+    const double *const *lowers, const double *const *uppers,
+    OsiCuts *cs, const CglTreeInfo info = CglTreeInfo());
   //@}
 
   /**@name Constructors and destructors */
@@ -117,6 +136,11 @@ public:
   virtual bool mayGenerateRowCutsInTree() const;
   /// Return true if needs optimal basis to do cuts
   virtual bool needsOptimalBasis() const;
+  /** Return true if cuts only depend on column solution, bounds and
+      matrix (and not on duals, reduced costs, row activities, objective
+      value or basis) - so default generateCutsMulti can use any point.
+      Default is false */
+  virtual bool needsOnlySolution() const;
   /// Return true if needs original model with the corr. solution (not preprocessed)
   virtual bool needsOriginalModel() const;
   /// Return maximum length of cut in tree
@@ -142,6 +166,19 @@ public:
   bool canDoGlobalCuts_;
 };
 
+//#############################################################################
+/** A function that tests the classes in CglCommon which are shared by
+    cut generators (solution digest, model components, implied integers,
+    separation cache and fixed column compression). The only
+    reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method
+    should be compiled with debugging. */
+
+CGLLIB_EXPORT
+void CglCommonUnitTest(const OsiSolverInterface *siP,
+  const std::string mpdDir);
+
 #endif
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -0,0 +1,255 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cmath>
+
+#include "CoinPragma.hpp"
+#include "CglFixedColumnCompression.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+
+//-------------------------------------------------------------------
+// Compact model for node with many fixed columns
+//-------------------------------------------------------------------
+CglFixedColumnCompression::CglFixedColumnCompression()
+  : solver_(NULL)
+  , originalColumns_(NULL)
+  , originalRows_(NULL)
+{
+}
+
+CglFixedColumnCompression::CglFixedColumnCompression(const CglFixedColumnCompression &rhs)
+{
+  gutsOfCopy(rhs);
+}
+
+CglFixedColumnCompression &
+CglFixedColumnCompression::operator=(const CglFixedColumnCompression &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+CglFixedColumnCompression::~CglFixedColumnCompression()
+{
+  gutsOfDelete();
+}
+
+void CglFixedColumnCompression::gutsOfDelete()
+{
+  delete solver_;
+  delete[] originalColumns_;
+  delete[] originalRows_;
+  solver_ = NULL;
+  originalColumns_ = NULL;
+  originalRows_ = NULL;
+}
+
+void CglFixedColumnCompression::gutsOfCopy(const CglFixedColumnCompression &rhs)
+{
+  if (rhs.solver_) {
+    solver_ = rhs.solver_->clone();
+    originalColumns_ = CoinCopyOfArray(rhs.originalColumns_, solver_->getNumCols());
+    originalRows_ = CoinCopyOfArray(rhs.originalRows_, solver_->getNumRows());
+  } else {
+    solver_ = NULL;
+    originalColumns_ = NULL;
+    originalRows_ = NULL;
+  }
+}
+
+// Builds compact model from current node of si
+int CglFixedColumnCompression::compress(const OsiSolverInterface &si,
+  double maximumFraction)
+{
+  gutsOfDelete();
+  const int numberColumns = si.getNumCols();
+  const int numberRows = si.getNumRows();
+  const double *lower = si.getColLower();
+  const double *upper = si.getColUpper();
+  int *whichColumn = new int[numberColumns];
+  int numberFree = 0;
+  for (int i = 0; i < numberColumns; i++) {
+    if (lower[i] < upper[i])
+      whichColumn[numberFree++] = i;
+  }
+  if (numberFree > maximumFraction * numberColumns) {
+    delete[] whichColumn;
+    return -1;
+  }
+  const CoinPackedMatrix *columnCopy = si.getMatrixByCol();
+  const int *row = columnCopy->getIndices();
+  const CoinBigIndex *columnStart = columnCopy->getVectorStarts();
+  const int *columnLength = columnCopy->getVectorLengths();
+  const double *element = columnCopy->getElements();
+  const double *solution = si.getColSolution();
+  const double *rowActivity = si.getRowActivity();
+  const double *rowLower = si.getRowLower();
+  const double *rowUpper = si.getRowUpper();
+  // number rows with free columns in order found
+  int *rowMap = new int[numberRows];
+  CoinFillN(rowMap, numberRows, -1);
+  int *whichRow = new int[numberRows];
+  int numberUsed = 0;
+  CoinBigIndex numberElements = 0;
+  for (int k = 0; k < numberFree; k++) {
+    int iColumn = whichColumn[k];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = row[j];
+      if (rowMap[iRow] < 0) {
+        rowMap[iRow] = numberUsed;
+        whichRow[numberUsed++] = iRow;
+      }
+    }
+    numberElements += columnLength[iColumn];
+  }
+  // activity of free part and its range
+  double *freeActivity = new double[3 * numberUsed];
+  double *minActivity = freeActivity + numberUsed;
+  double *maxActivity = minActivity + numberUsed;
+  CoinZeroN(freeActivity, 3 * numberUsed);
+  for (int k = 0; k < numberFree; k++) {
+    int iColumn = whichColumn[k];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = rowMap[row[j]];
+      double value = element[j];
+      freeActivity[iRow] += value * solution[iColumn];
+      double lo = value > 0.0 ? lower[iColumn] : upper[iColumn];
+      double up = value > 0.0 ? upper[iColumn] : lower[iColumn];
+      if (fabs(lo) < 1.0e30 && minActivity[iRow] > -COIN_DBL_MAX)
+        minActivity[iRow] += value * lo;
+      else
+        minActivity[iRow] = -COIN_DBL_MAX;
+      if (fabs(up) < 1.0e30 && maxActivity[iRow] < COIN_DBL_MAX)
+        maxActivity[iRow] += value * up;
+      else
+        maxActivity[iRow] = COIN_DBL_MAX;
+    }
+  }
+  // keep rows which can still be tight
+  double *newRowLower = new double[2 * numberUsed];
+  double *newRowUpper = newRowLower + numberUsed;
+  int numberKept = 0;
+  for (int k = 0; k < numberUsed; k++) {
+    int iRow = whichRow[k];
+    double fixedActivity = rowActivity[iRow] - freeActivity[k];
+    double lo = rowLower[iRow] > -1.0e30 ? rowLower[iRow] - fixedActivity : -COIN_DBL_MAX;
+    double up = rowUpper[iRow] < 1.0e30 ? rowUpper[iRow] - fixedActivity : COIN_DBL_MAX;
+    if (minActivity[k] >= lo - 1.0e-8 && maxActivity[k] <= up + 1.0e-8) {
+      rowMap[iRow] = -1;
+      continue;
+    }
+    rowMap[iRow] = numberKept;
+    whichRow[numberKept] = iRow;
+    newRowLower[numberKept] = lo;
+    newRowUpper[numberKept++] = up;
+  }
+  delete[] freeActivity;
+  // compact column copy
+  CoinBigIndex *newStart = new CoinBigIndex[numberFree + 1];
+  int *newRow = new int[numberElements];
+  double *newElement = new double[numberElements];
+  double *newLower = new double[4 * numberFree];
+  double *newUpper = newLower + numberFree;
+  double *newObjective = newUpper + numberFree;
+  double *newSolution = newObjective + numberFree;
+  const double *objective = si.getObjCoefficients();
+  int *integers = new int[numberFree];
+  int numberIntegers = 0;
+  numberElements = 0;
+  newStart[0] = 0;
+  for (int k = 0; k < numberFree; k++) {
+    int iColumn = whichColumn[k];
+    for (CoinBigIndex j = columnStart[iColumn];
+         j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+      int iRow = rowMap[row[j]];
+      if (iRow >= 0) {
+        newRow[numberElements] = iRow;
+        newElement[numberElements++] = element[j];
+      }
+    }
+    newStart[k + 1] = numberElements;
+    newLower[k] = lower[iColumn];
+    newUpper[k] = upper[iColumn];
+    newObjective[k] = objective[iColumn];
+    newSolution[k] = solution[iColumn];
+    if (si.isInteger(iColumn))
+      integers[numberIntegers++] = k;
+  }
+  delete[] rowMap;
+  solver_ = si.clone(false);
+  solver_->loadProblem(numberFree, numberKept, newStart, newRow, newElement,
+    newLower, newUpper, newObjective, newRowLower, newRowUpper);
+  solver_->setObjSense(si.getObjSense());
+  solver_->setInteger(integers, numberIntegers);
+  solver_->setColSolution(newSolution);
+  // not solved - so no duals and no cutoff to use with reduced costs
+  double *zeroPrice = new double[CoinMax(numberKept, 1)];
+  CoinZeroN(zeroPrice, numberKept);
+  solver_->setRowPrice(zeroPrice);
+  delete[] zeroPrice;
+  solver_->setDblParam(OsiDualObjectiveLimit, si.getObjSense() * COIN_DBL_MAX);
+  originalColumns_ = CoinCopyOfArray(whichColumn, numberFree);
+  originalRows_ = CoinCopyOfArray(whichRow, numberKept);
+  delete[] whichColumn;
+  delete[] whichRow;
+  delete[] newRowLower;
+  delete[] newStart;
+  delete[] newRow;
+  delete[] newElement;
+  delete[] newLower;
+  delete[] integers;
+  return numberFree;
+}
+
+// Generates cuts for compact model and adds them in original indices
+void CglFixedColumnCompression::generateCuts(CglCutGenerator &generator,
+  OsiCuts &cs, const CglTreeInfo &info) const
+{
+  // compact model has no basis or duals
+  if (!solver_ || generator.needsOptimalBasis())
+    return;
+  // information in original indices is no use for compact model
+  CglTreeInfo compactInfo(info);
+  compactInfo.formulation_rows = solver_->getNumRows();
+  compactInfo.originalColumns = NULL;
+  compactInfo.strengthenRow = NULL;
+  compactInfo.options &= ~(4 | 8 | 16);
+  OsiCuts compactCuts;
+  generator.generateCuts(*solver_, compactCuts, compactInfo);
+  int n = compactCuts.sizeRowCuts();
+  for (int i = 0; i < n; i++) {
+    OsiRowCut rc = compactCuts.rowCut(i);
+    CoinPackedVector &vector = rc.mutableRow();
+    int *index = vector.getIndices();
+    for (int j = 0; j < vector.getNumElements(); j++)
+      index[j] = originalColumns_[index[j]];
+    rc.setGloballyValid(false);
+    cs.insertIfNotDuplicate(rc);
+  }
+  n = compactCuts.sizeColCuts();
+  for (int i = 0; i < n; i++) {
+    OsiColCut cc = compactCuts.colCut(i);
+    CoinPackedVector lbs = cc.lbs();
+    CoinPackedVector ubs = cc.ubs();
+    int *index = lbs.getIndices();
+    for (int j = 0; j < lbs.getNumElements(); j++)
+      index[j] = originalColumns_[index[j]];
+    index = ubs.getIndices();
+    for (int j = 0; j < ubs.getNumElements(); j++)
+      index[j] = originalColumns_[index[j]];
+    cc.setLbs(lbs);
+    cc.setUbs(ubs);
+    cc.setGloballyValid(false);
+    cs.insert(cc);
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,76 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglFixedColumnCompression_H
+#define CglFixedColumnCompression_H
+
+#include "OsiCuts.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglConfig.h"
+#include "CglCutGenerator.hpp"
+
+/** Compact model for a node where many columns are fixed.
+    compress takes the free columns of the current node, moves fixed
+    columns into row bounds (using row activities of current solution)
+    and drops rows which are then redundant.  Apart from finding free
+    columns the work is proportional to the free part of the model.
+    generateCuts runs a cut generator on the compact model and gives the
+    cuts in original indices.  As fixed values are in row bounds these
+    cuts are only valid at this node.
+    The compact model is never solved.  It has the solution of the node
+    but no basis, zero row duals and no meaningful reduced costs, so it
+    is only for generators which do not need an optimal basis (knapsack
+    cover, flow cover, mixed integer rounding, clique) - generateCuts
+    does nothing for a generator whose needsOptimalBasis() is true.  Its
+    dual objective limit is infinite so generators which fix columns
+    from reduced costs and a cutoff (e.g. CglProbing) do not do so.
+*/
+class CGLLIB_EXPORT CglFixedColumnCompression {
+public:
+  /// Default constructor
+  CglFixedColumnCompression();
+  /// Copy constructor
+  CglFixedColumnCompression(const CglFixedColumnCompression &);
+  /// Assignment operator
+  CglFixedColumnCompression &operator=(const CglFixedColumnCompression &rhs);
+  /// Destructor
+  ~CglFixedColumnCompression();
+  /** Builds compact model from current node of si.  Returns number of
+      free columns, or -1 (and no model) if fraction of columns which
+      are free is more than maximumFraction. */
+  int compress(const OsiSolverInterface &si, double maximumFraction = 0.2);
+  /** Generates cuts for compact model with generator and adds them (in
+      original indices, not globally valid) to cs.  Does nothing if
+      generator needs an optimal basis. */
+  void generateCuts(CglCutGenerator &generator, OsiCuts &cs,
+    const CglTreeInfo &info = CglTreeInfo()) const;
+  /// Compact model (or NULL)
+  inline const OsiSolverInterface *solver() const
+  {
+    return solver_;
+  }
+  /// Original index of each column of compact model
+  inline const int *originalColumns() const
+  {
+    return originalColumns_;
+  }
+  /// Original index of each row of compact model
+  inline const int *originalRows() const
+  {
+    return originalRows_;
+  }
+
+private:
+  void gutsOfDelete();
+  void gutsOfCopy(const CglFixedColumnCompression &rhs);
+  /// Compact model
+  OsiSolverInterface *solver_;
+  /// Original index of each column of compact model
+  int *originalColumns_;
+  /// Original index of each row of compact model
+  int *originalRows_;
+};
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
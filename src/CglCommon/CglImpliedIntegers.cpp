@@ -0,0 +1,202 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#include "CoinPragma.hpp"
+#include "CglImpliedIntegers.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+
+// Default constructor
+CglImpliedIntegers::CglImpliedIntegers()
+  : status_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberImplied_(0)
+  , allowWeak_(false)
+{
+}
+// Constructor from solver
+CglImpliedIntegers::CglImpliedIntegers(const OsiSolverInterface &si, int type)
+  : status_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberImplied_(0)
+  , allowWeak_(false)
+{
+  compute(si, type);
+}
+// Copy constructor
+CglImpliedIntegers::CglImpliedIntegers(const CglImpliedIntegers &rhs)
+  : status_(CoinCopyOfArray(rhs.status_, rhs.numberColumns_))
+  , numberColumns_(rhs.numberColumns_)
+  , numberRows_(rhs.numberRows_)
+  , numberImplied_(rhs.numberImplied_)
+  , allowWeak_(rhs.allowWeak_)
+{
+}
+// Assignment operator
+CglImpliedIntegers &
+CglImpliedIntegers::operator=(const CglImpliedIntegers &rhs)
+{
+  if (this != &rhs) {
+    delete[] status_;
+    status_ = CoinCopyOfArray(rhs.status_, rhs.numberColumns_);
+    numberColumns_ = rhs.numberColumns_;
+    numberRows_ = rhs.numberRows_;
+    numberImplied_ = rhs.numberImplied_;
+    allowWeak_ = rhs.allowWeak_;
+  }
+  return *this;
+}
+// Destructor
+CglImpliedIntegers::~CglImpliedIntegers()
+{
+  delete[] status_;
+}
+static inline bool isIntegral(double value)
+{
+  return fabs(value - floor(value + 0.5)) < 1.0e-10;
+}
+// True if column integer or can be treated as integer with these bounds
+bool CglImpliedIntegers::isInteger(int iColumn, double lower, double upper) const
+{
+  int type = status_[iColumn];
+  if (type < 2)
+    return type != 0;
+  if (type == 3 && !allowWeak_)
+    return false;
+  // cuts assume distance from bound is integer
+  return (lower < -1.0e20 || isIntegral(lower)) && (upper > 1.0e20 || isIntegral(upper));
+}
+// (Re)computes status
+int CglImpliedIntegers::compute(const OsiSolverInterface &si, int type)
+{
+  delete[] status_;
+  numberColumns_ = si.getNumCols();
+  numberRows_ = si.getNumRows();
+  numberImplied_ = 0;
+  status_ = new char[numberColumns_];
+  const double *columnLower = si.getColLower();
+  const double *columnUpper = si.getColUpper();
+  const double *rowLower = si.getRowLower();
+  const double *rowUpper = si.getRowUpper();
+  for (int i = 0; i < numberColumns_; i++) {
+    if (si.isInteger(i)) {
+      status_[i] = 1;
+    } else if (columnLower[i] == columnUpper[i] && isIntegral(columnLower[i])) {
+      status_[i] = 2;
+      numberImplied_++;
+    } else {
+      status_[i] = 0;
+    }
+  }
+  const CoinPackedMatrix *columnCopy = si.getMatrixByCol();
+  const int *row = columnCopy->getIndices();
+  const CoinBigIndex *columnStart = columnCopy->getVectorStarts();
+  const int *columnLength = columnCopy->getVectorLengths();
+  const CoinPackedMatrix *rowCopy = si.getMatrixByRow();
+  const double *elementByRow = rowCopy->getElements();
+  const int *column = rowCopy->getIndices();
+  const CoinBigIndex *rowStart = rowCopy->getVectorStarts();
+  const int *rowLength = rowCopy->getVectorLengths();
+  if ((type & 1) != 0) {
+    // worklist of equality rows
+    int *list = new int[numberRows_];
+    char *inList = new char[numberRows_];
+    int nList = 0;
+    for (int iRow = 0; iRow < numberRows_; iRow++) {
+      if (rowLower[iRow] == rowUpper[iRow]) {
+        list[nList++] = iRow;
+        inList[iRow] = 1;
+      } else {
+        inList[iRow] = 0;
+      }
+    }
+    while (nList) {
+      int iRow = list[--nList];
+      inList[iRow] = 0;
+      CoinBigIndex start = rowStart[iRow];
+      CoinBigIndex end = start + rowLength[iRow];
+      // need exactly one continuous
+      int jColumn = -1;
+      double value = 0.0;
+      for (CoinBigIndex j = start; j < end; j++) {
+        if (!status_[column[j]]) {
+          if (jColumn >= 0) {
+            jColumn = -2;
+            break;
+          }
+          jColumn = column[j];
+          value = elementByRow[j];
+        }
+      }
+      if (jColumn < 0 || !isIntegral(rowUpper[iRow] / value))
+        continue;
+      bool good = true;
+      for (CoinBigIndex j = start; j < end; j++) {
+        if (column[j] != jColumn && !isIntegral(elementByRow[j] / value)) {
+          good = false;
+          break;
+        }
+      }
+      if (!good)
+        continue;
+      status_[jColumn] = 2;
+      numberImplied_++;
+      // other equality rows may now have one continuous
+      for (CoinBigIndex j = columnStart[jColumn];
+           j < columnStart[jColumn] + columnLength[jColumn]; j++) {
+        int kRow = row[j];
+        if (rowLower[kRow] == rowUpper[kRow] && !inList[kRow]) {
+          list[nList++] = kRow;
+          inList[kRow] = 1;
+        }
+      }
+    }
+    delete[] list;
+    delete[] inList;
+  }
+  if ((type & 2) != 0) {
+    const double *element = columnCopy->getElements();
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+      if (status_[iColumn])
+        continue;
+      if (columnLower[iColumn] > -1.0e20 && !isIntegral(columnLower[iColumn]))
+        continue;
+      if (columnUpper[iColumn] < 1.0e20 && !isIntegral(columnUpper[iColumn]))
+        continue;
+      bool good = true;
+      for (CoinBigIndex k = columnStart[iColumn];
+           k < columnStart[iColumn] + columnLength[iColumn]; k++) {
+        int iRow = row[k];
+        double value = element[k];
+        if ((rowLower[iRow] > -1.0e20 && !isIntegral(rowLower[iRow] / value)) || (rowUpper[iRow] < 1.0e20 && !isIntegral(rowUpper[iRow] / value))) {
+          good = false;
+          break;
+        }
+        // others must be integer (not just taken as integer)
+        for (CoinBigIndex j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++) {
+          int jColumn = column[j];
+          if (jColumn != iColumn && ((status_[jColumn] != 1 && status_[jColumn] != 2) || !isIntegral(elementByRow[j] / value))) {
+            good = false;
+            break;
+          }
+        }
+        if (!good)
+          break;
+      }
+      if (good) {
+        status_[iColumn] = 3;
+        numberImplied_++;
+      }
+    }
+  }
+  return numberImplied_;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
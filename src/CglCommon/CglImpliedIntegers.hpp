@@ -0,0 +1,94 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglImpliedIntegers_H
+#define CglImpliedIntegers_H
+
+#include "OsiSolverInterface.hpp"
+#include "CglConfig.h"
+
+/** Continuous columns which can be treated as integer.
+    A column is implied integer by an equality row if all other columns
+    in the row are integer and the row, scaled so the column has
+    coefficient one, has integer coefficients and rhs.  This is found
+    to a fixpoint using a worklist of equality rows.
+    A column may also be taken as integer if it has integer (or no)
+    bounds and every row it is in passes the same test - then for any
+    integer values of the other columns it has an integer optimal value.
+    This is weaker and depends on bounds: only some optimal solution
+    has the column integral, so a cut treating it as integer may cut off
+    feasible and even optimal solutions.  isInteger only accepts such
+    columns after setAllowWeak(true), which is only safe when any one
+    optimal solution will do.
+*/
+class CGLLIB_EXPORT CglImpliedIntegers {
+public:
+  /// Default constructor
+  CglImpliedIntegers();
+  /// Constructor from solver (see compute)
+  CglImpliedIntegers(const OsiSolverInterface &si, int type = 3);
+  /// Copy constructor
+  CglImpliedIntegers(const CglImpliedIntegers &);
+  /// Assignment operator
+  CglImpliedIntegers &operator=(const CglImpliedIntegers &rhs);
+  /// Destructor
+  ~CglImpliedIntegers();
+  /** (Re)computes status.
+      type 1 - implied by equality rows, 2 - taken from all rows, 3 - both.
+      Returns number of continuous columns found to be integer. */
+  int compute(const OsiSolverInterface &si, int type = 3);
+  /** Status of each column
+      0 continuous, 1 integer, 2 implied integer (or fixed at integer),
+      3 may be taken as integer */
+  inline const char *status() const
+  {
+    return status_;
+  }
+  /** True if column integer or can be treated as integer with these
+      bounds (continuous columns need integer or infinite bounds as
+      cuts use distance from bound).  Status 3 only if allowWeak(). */
+  bool isInteger(int iColumn, double lower, double upper) const;
+  /** Set whether isInteger accepts columns with status 3 (integral in
+      some optimal solution) - default false */
+  inline void setAllowWeak(bool yesNo)
+  {
+    allowWeak_ = yesNo;
+  }
+  /// Whether isInteger accepts columns with status 3
+  inline bool allowWeak() const
+  {
+    return allowWeak_;
+  }
+  /// Number of continuous columns found to be integer
+  inline int numberImplied() const
+  {
+    return numberImplied_;
+  }
+  /// Number of columns in model
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  /// Number of rows in model
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+
+private:
+  /// Status of each column
+  char *status_;
+  /// Number of columns in model
+  int numberColumns_;
+  /// Number of rows in model
+  int numberRows_;
+  /// Number of continuous columns found to be integer
+  int numberImplied_;
+  /// Whether isInteger accepts columns with status 3
+  bool allowWeak_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
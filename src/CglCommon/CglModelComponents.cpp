@@ -0,0 +1,191 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+
+#include "CoinPragma.hpp"
+#include "CglModelComponents.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+
+// Default constructor
+CglModelComponents::CglModelComponents()
+  : columnComponent_(NULL)
+  , rowComponent_(NULL)
+  , componentStart_(NULL)
+  , componentColumns_(NULL)
+  , componentRows_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberComponents_(0)
+{
+}
+// Constructor from solver
+CglModelComponents::CglModelComponents(const OsiSolverInterface &si)
+  : columnComponent_(NULL)
+  , rowComponent_(NULL)
+  , componentStart_(NULL)
+  , componentColumns_(NULL)
+  , componentRows_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberComponents_(0)
+{
+  compute(si);
+}
+// Copy constructor
+CglModelComponents::CglModelComponents(const CglModelComponents &rhs)
+{
+  gutsOfCopy(rhs);
+}
+// Assignment operator
+CglModelComponents &
+CglModelComponents::operator=(const CglModelComponents &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+// Destructor
+CglModelComponents::~CglModelComponents()
+{
+  gutsOfDelete();
+}
+// Frees arrays
+void CglModelComponents::gutsOfDelete()
+{
+  delete[] columnComponent_;
+  delete[] rowComponent_;
+  delete[] componentStart_;
+  delete[] componentColumns_;
+  delete[] componentRows_;
+  columnComponent_ = NULL;
+  rowComponent_ = NULL;
+  componentStart_ = NULL;
+  componentColumns_ = NULL;
+  componentRows_ = NULL;
+  numberColumns_ = 0;
+  numberRows_ = 0;
+  numberComponents_ = 0;
+}
+// Copies arrays
+void CglModelComponents::gutsOfCopy(const CglModelComponents &rhs)
+{
+  numberColumns_ = rhs.numberColumns_;
+  numberRows_ = rhs.numberRows_;
+  numberComponents_ = rhs.numberComponents_;
+  columnComponent_ = CoinCopyOfArray(rhs.columnComponent_, numberColumns_);
+  rowComponent_ = CoinCopyOfArray(rhs.rowComponent_, numberRows_);
+  componentStart_ = CoinCopyOfArray(rhs.componentStart_, numberComponents_ + 1);
+  componentColumns_ = CoinCopyOfArray(rhs.componentColumns_, numberColumns_);
+  componentRows_ = CoinCopyOfArray(rhs.componentRows_, numberComponents_);
+}
+// (Re)computes components
+int CglModelComponents::compute(const OsiSolverInterface &si)
+{
+  gutsOfDelete();
+  numberColumns_ = si.getNumCols();
+  numberRows_ = si.getNumRows();
+  const CoinPackedMatrix *rowCopy = si.getMatrixByRow();
+  const int *column = rowCopy->getIndices();
+  const CoinBigIndex *rowStart = rowCopy->getVectorStarts();
+  const int *rowLength = rowCopy->getVectorLengths();
+  /* union-find on columns - union by size and path compression so
+     work is (almost) linear in number of elements */
+  int *parent = new int[numberColumns_];
+  int *size = new int[numberColumns_];
+  for (int i = 0; i < numberColumns_; i++) {
+    parent[i] = i;
+    size[i] = 1;
+  }
+  char *used = new char[numberColumns_];
+  CoinZeroN(used, numberColumns_);
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    CoinBigIndex start = rowStart[iRow];
+    CoinBigIndex end = start + rowLength[iRow];
+    if (start == end)
+      continue;
+    // root of first
+    int root = column[start];
+    while (parent[root] != root)
+      root = parent[root];
+    for (CoinBigIndex j = start; j < end; j++) {
+      int iColumn = column[j];
+      used[iColumn] = 1;
+      int other = iColumn;
+      while (parent[other] != other)
+        other = parent[other];
+      // compress path
+      while (parent[iColumn] != other) {
+        int next = parent[iColumn];
+        parent[iColumn] = other;
+        iColumn = next;
+      }
+      if (other != root) {
+        // hang smaller tree under larger
+        if (size[other] > size[root]) {
+          int temp = root;
+          root = other;
+          other = temp;
+        }
+        parent[other] = root;
+        size[root] += size[other];
+      }
+    }
+  }
+  // number components in order of first column (size re-used for number)
+  columnComponent_ = new int[numberColumns_];
+  for (int i = 0; i < numberColumns_; i++)
+    size[i] = -1;
+  for (int i = 0; i < numberColumns_; i++) {
+    if (!used[i]) {
+      columnComponent_[i] = -1;
+      continue;
+    }
+    int root = i;
+    while (parent[root] != root)
+      root = parent[root];
+    if (size[root] < 0)
+      size[root] = numberComponents_++;
+    columnComponent_[i] = size[root];
+  }
+  delete[] size;
+  delete[] parent;
+  delete[] used;
+  componentStart_ = new int[numberComponents_ + 1];
+  componentRows_ = new int[numberComponents_];
+  CoinZeroN(componentStart_, numberComponents_ + 1);
+  CoinZeroN(componentRows_, numberComponents_);
+  for (int i = 0; i < numberColumns_; i++) {
+    int iComponent = columnComponent_[i];
+    if (iComponent >= 0)
+      componentStart_[iComponent + 1]++;
+  }
+  for (int i = 0; i < numberComponents_; i++)
+    componentStart_[i + 1] += componentStart_[i];
+  componentColumns_ = new int[numberColumns_];
+  int *put = CoinCopyOfArray(componentStart_, numberComponents_);
+  for (int i = 0; i < numberColumns_; i++) {
+    int iComponent = columnComponent_[i];
+    if (iComponent >= 0)
+      componentColumns_[put[iComponent]++] = i;
+  }
+  delete[] put;
+  rowComponent_ = new int[numberRows_];
+  for (int iRow = 0; iRow < numberRows_; iRow++) {
+    if (rowLength[iRow]) {
+      int iComponent = columnComponent_[column[rowStart[iRow]]];
+      rowComponent_[iRow] = iComponent;
+      componentRows_[iComponent]++;
+    } else {
+      rowComponent_[iRow] = -1;
+    }
+  }
+  return numberComponents_;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,103 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglModelComponents_H
+#define CglModelComponents_H
+
+#include "OsiSolverInterface.hpp"
+#include "CglConfig.h"
+
+/** Connected components of the row-column graph of a model.
+    Rows and columns in different components share no elements so
+    they can be treated as independent problems linked only by the
+    objective.  Empty rows and columns are not in any component. */
+class CGLLIB_EXPORT CglModelComponents {
+public:
+  /// Default constructor
+  CglModelComponents();
+  /// Constructor from solver
+  CglModelComponents(const OsiSolverInterface &si);
+  /// Copy constructor
+  CglModelComponents(const CglModelComponents &);
+  /// Assignment operator
+  CglModelComponents &operator=(const CglModelComponents &rhs);
+  /// Destructor
+  ~CglModelComponents();
+  /** (Re)computes components - returns number of components.
+      Union-find by size with path compression so nearly linear in
+      number of elements.  Components are numbered in order of their
+      first column. */
+  int compute(const OsiSolverInterface &si);
+  /// Number of components
+  inline int numberComponents() const
+  {
+    return numberComponents_;
+  }
+  /// Component of each column (-1 if empty)
+  inline const int *columnComponent() const
+  {
+    return columnComponent_;
+  }
+  /// Component of each row (-1 if empty)
+  inline const int *rowComponent() const
+  {
+    return rowComponent_;
+  }
+  /// Start of columns for each component in componentColumns()
+  inline const int *componentStart() const
+  {
+    return componentStart_;
+  }
+  /// Columns in order of component
+  inline const int *componentColumns() const
+  {
+    return componentColumns_;
+  }
+  /// Number of columns in a component
+  inline int numberColumns(int iComponent) const
+  {
+    return componentStart_[iComponent + 1] - componentStart_[iComponent];
+  }
+  /// Number of rows in a component
+  inline int numberRows(int iComponent) const
+  {
+    return componentRows_[iComponent];
+  }
+  /// Number of columns in model
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  /// Number of rows in model
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+
+private:
+  /// Frees arrays
+  void gutsOfDelete();
+  /// Copies arrays
+  void gutsOfCopy(const CglModelComponents &rhs);
+  /// Component of each column
+  int *columnComponent_;
+  /// Component of each row
+  int *rowComponent_;
+  /// Start of columns for each component
+  int *componentStart_;
+  /// Columns in order of component
+  int *componentColumns_;
+  /// Number of rows in each component
+  int *componentRows_;
+  /// Number of columns in model
+  int numberColumns_;
+  /// Number of rows in model
+  int numberRows_;
+  /// Number of components
+  int numberComponents_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,375 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+
+#include "CoinPragma.hpp"
+#include "CglSeparationCache.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinWarmStartBasis.hpp"
+#include "CoinPackedMatrix.hpp"
+
+// Default constructor
+CglSeparationCache::CglSeparationCache(int maximumEntries)
+  : maximumEntries_(CoinMax(maximumEntries, 1))
+  , numberEntries_(0)
+  , clock_(0)
+  , numberHits_(0)
+  , numberMisses_(0)
+  , key_(NULL)
+  , keyLength_(0)
+  , keySize_(0)
+  , hash_(0)
+{
+  entryKey_ = new double *[maximumEntries_];
+  entryLength_ = new int[maximumEntries_];
+  entryHash_ = new unsigned int[maximumEntries_];
+  entryUsed_ = new int[maximumEntries_];
+  entryCuts_ = new OsiCuts[maximumEntries_];
+}
+
+// Copy constructor
+CglSeparationCache::CglSeparationCache(const CglSeparationCache &rhs)
+{
+  gutsOfCopy(rhs);
+}
+
+// Assignment operator
+CglSeparationCache &
+CglSeparationCache::operator=(const CglSeparationCache &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+
+// Destructor
+CglSeparationCache::~CglSeparationCache()
+{
+  gutsOfDelete();
+}
+
+void CglSeparationCache::gutsOfDelete()
+{
+  for (int i = 0; i < numberEntries_; i++)
+    delete[] entryKey_[i];
+  delete[] entryKey_;
+  delete[] entryLength_;
+  delete[] entryHash_;
+  delete[] entryUsed_;
+  delete[] entryCuts_;
+  delete[] key_;
+}
+
+void CglSeparationCache::gutsOfCopy(const CglSeparationCache &rhs)
+{
+  maximumEntries_ = rhs.maximumEntries_;
+  numberEntries_ = rhs.numberEntries_;
+  clock_ = rhs.clock_;
+  numberHits_ = rhs.numberHits_;
+  numberMisses_ = rhs.numberMisses_;
+  entryKey_ = new double *[maximumEntries_];
+  entryLength_ = CoinCopyOfArrayPartial(rhs.entryLength_, maximumEntries_, numberEntries_);
+  entryHash_ = CoinCopyOfArrayPartial(rhs.entryHash_, maximumEntries_, numberEntries_);
+  entryUsed_ = CoinCopyOfArrayPartial(rhs.entryUsed_, maximumEntries_, numberEntries_);
+  entryCuts_ = new OsiCuts[maximumEntries_];
+  for (int i = 0; i < numberEntries_; i++) {
+    entryKey_[i] = CoinCopyOfArray(rhs.entryKey_[i], rhs.entryLength_[i]);
+    entryCuts_[i] = rhs.entryCuts_[i];
+  }
+  // current state is not copied
+  key_ = NULL;
+  keyLength_ = 0;
+  keySize_ = 0;
+  hash_ = 0;
+}
+
+// Forgets all saved results
+void CglSeparationCache::clear()
+{
+  for (int i = 0; i < numberEntries_; i++) {
+    delete[] entryKey_[i];
+    entryCuts_[i] = OsiCuts();
+  }
+  numberEntries_ = 0;
+  keyLength_ = 0;
+}
+
+// Puts current state into key_ and hash_
+bool CglSeparationCache::makeKey(const OsiSolverInterface &si,
+  const CglTreeInfo &info, bool withBasis)
+{
+  const int numberColumns = si.getNumCols();
+  const int numberRows = si.getNumRows();
+  CoinWarmStartBasis *basis = NULL;
+  if (withBasis) {
+    CoinWarmStart *warmStart = si.getWarmStart();
+    basis = dynamic_cast< CoinWarmStartBasis * >(warmStart);
+    if (!basis) {
+      // key would not see a change of basis - so do not cache
+      delete warmStart;
+      keyLength_ = 0;
+      return false;
+    }
+  }
+  // hash of matrix so a change of coefficients (same count) is seen
+  unsigned int matrixHash = 2166136261U;
+  const CoinPackedMatrix *matrix = si.getMatrixByCol();
+  if (matrix) {
+    const double *element = matrix->getElements();
+    const int *row = matrix->getIndices();
+    const CoinBigIndex *columnStart = matrix->getVectorStarts();
+    const int *columnLength = matrix->getVectorLengths();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+      for (CoinBigIndex j = columnStart[iColumn];
+           j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+        const unsigned char *byte = reinterpret_cast< const unsigned char * >(element + j);
+        for (int k = 0; k < static_cast< int >(sizeof(double)); k++) {
+          matrixHash ^= byte[k];
+          matrixHash *= 16777619U;
+        }
+        matrixHash ^= static_cast< unsigned int >(row[j]);
+        matrixHash *= 16777619U;
+      }
+      matrixHash ^= static_cast< unsigned int >(iColumn);
+      matrixHash *= 16777619U;
+    }
+  }
+  int size = 8 + 3 * numberColumns + 2 * numberRows;
+  if (basis)
+    size += numberColumns + numberRows;
+  if (size > keySize_) {
+    delete[] key_;
+    keySize_ = size;
+    key_ = new double[keySize_];
+  }
+  double *put = key_;
+  *put++ = numberColumns;
+  *put++ = numberRows;
+  *put++ = static_cast< double >(si.getNumElements());
+  *put++ = matrixHash;
+  *put++ = info.inTree ? 1.0 : 0.0;
+  *put++ = info.options;
+  *put++ = info.level;
+  *put++ = info.pass;
+  CoinMemcpyN(si.getColSolution(), numberColumns, put);
+  put += numberColumns;
+  CoinMemcpyN(si.getColLower(), numberColumns, put);
+  put += numberColumns;
+  CoinMemcpyN(si.getColUpper(), numberColumns, put);
+  put += numberColumns;
+  CoinMemcpyN(si.getRowLower(), numberRows, put);
+  put += numberRows;
+  CoinMemcpyN(si.getRowUpper(), numberRows, put);
+  put += numberRows;
+  if (basis) {
+    for (int i = 0; i < numberColumns; i++)
+      *put++ = basis->getStructStatus(i);
+    for (int i = 0; i < numberRows; i++)
+      *put++ = basis->getArtifStatus(i);
+    delete basis;
+  }
+  keyLength_ = static_cast< int >(put - key_);
+  // FNV-1a on bytes
+  unsigned int hash = 2166136261U;
+  const unsigned char *byte = reinterpret_cast< const unsigned char * >(key_);
+  const int numberBytes = keyLength_ * static_cast< int >(sizeof(double));
+  for (int i = 0; i < numberBytes; i++) {
+    hash ^= byte[i];
+    hash *= 16777619U;
+  }
+  hash_ = hash;
+  return true;
+}
+
+// Returns cuts saved for current state of si or NULL
+const OsiCuts *
+CglSeparationCache::find(const OsiSolverInterface &si, const CglTreeInfo &info,
+  bool withBasis)
+{
+  if (!makeKey(si, info, withBasis)) {
+    numberMisses_++;
+    return NULL;
+  }
+  for (int i = 0; i < numberEntries_; i++) {
+    if (entryHash_[i] != hash_ || entryLength_[i] != keyLength_)
+      continue;
+    const double *key = entryKey_[i];
+    int j;
+    for (j = 0; j < keyLength_; j++) {
+      if (key[j] != key_[j])
+        break;
+    }
+    if (j == keyLength_) {
+      entryUsed_[i] = ++clock_;
+      numberHits_++;
+      return entryCuts_ + i;
+    }
+  }
+  numberMisses_++;
+  return NULL;
+}
+
+// Saves cuts for state given to last find
+void CglSeparationCache::add(const OsiCuts &cuts)
+{
+  if (!keyLength_)
+    return;
+  int which;
+  if (numberEntries_ < maximumEntries_) {
+    which = numberEntries_++;
+  } else {
+    // replace least recently used
+    which = 0;
+    for (int i = 1; i < numberEntries_; i++) {
+      if (entryUsed_[i] < entryUsed_[which])
+        which = i;
+    }
+    delete[] entryKey_[which];
+  }
+  entryKey_[which] = CoinCopyOfArray(key_, keyLength_);
+  entryLength_[which] = keyLength_;
+  entryHash_[which] = hash_;
+  entryUsed_[which] = ++clock_;
+  entryCuts_[which] = cuts;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglCachedCutGenerator::CglCachedCutGenerator()
+  : CglCutGenerator()
+  , generator_(NULL)
+{
+}
+
+//-------------------------------------------------------------------
+// Constructor from generator
+//-------------------------------------------------------------------
+CglCachedCutGenerator::CglCachedCutGenerator(const CglCutGenerator &generator,
+  int maximumEntries)
+  : CglCutGenerator()
+  , cache_(maximumEntries)
+{
+  generator_ = generator.clone();
+  setAggressiveness(generator.getAggressiveness());
+  setGlobalCuts(generator.canDoGlobalCuts());
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglCachedCutGenerator::CglCachedCutGenerator(const CglCachedCutGenerator &rhs)
+  : CglCutGenerator(rhs)
+  , cache_(rhs.cache_)
+{
+  generator_ = rhs.generator_ ? rhs.generator_->clone() : NULL;
+}
+
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+CglCutGenerator *
+CglCachedCutGenerator::clone() const
+{
+  return new CglCachedCutGenerator(*this);
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglCachedCutGenerator &
+CglCachedCutGenerator::operator=(const CglCachedCutGenerator &rhs)
+{
+  if (this != &rhs) {
+    CglCutGenerator::operator=(rhs);
+    delete generator_;
+    generator_ = rhs.generator_ ? rhs.generator_->clone() : NULL;
+    cache_ = rhs.cache_;
+  }
+  return *this;
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglCachedCutGenerator::~CglCachedCutGenerator()
+{
+  delete generator_;
+}
+
+// Refresh generator and forget saved results
+void CglCachedCutGenerator::refreshSolver(OsiSolverInterface *solver)
+{
+  if (generator_)
+    generator_->refreshSolver(solver);
+  cache_.clear();
+}
+
+// Generate cuts - reusing earlier results
+void CglCachedCutGenerator::generateCuts(const OsiSolverInterface &si,
+  OsiCuts &cs, const CglTreeInfo info)
+{
+  if (!generator_)
+    return;
+  const OsiCuts *cuts = cache_.find(si, info, generator_->needsOptimalBasis());
+  if (!cuts) {
+    // generate straight into cs so result is as without cache
+    const int numberRowCutsBefore = cs.sizeRowCuts();
+    const int numberColCutsBefore = cs.sizeColCuts();
+    generator_->generateCuts(si, cs, info);
+    OsiCuts newCuts;
+    for (int i = numberRowCutsBefore; i < cs.sizeRowCuts(); i++)
+      newCuts.insert(cs.rowCut(i));
+    for (int i = numberColCutsBefore; i < cs.sizeColCuts(); i++)
+      newCuts.insert(cs.colCut(i));
+    cache_.add(newCuts);
+  } else {
+    for (int i = 0; i < cuts->sizeRowCuts(); i++)
+      cs.insert(cuts->rowCut(i));
+    for (int i = 0; i < cuts->sizeColCuts(); i++)
+      cs.insert(cuts->colCut(i));
+  }
+}
+
+// Generate cuts for several points
+void CglCachedCutGenerator::generateCutsMulti(const OsiSolverInterface &si,
+  int numberPoints, const double *const *solutions,
+  const double *const *lowers, const double *const *uppers,
+  OsiCuts *cs, const CglTreeInfo info)
+{
+  if (generator_)
+    generator_->generateCutsMulti(si, numberPoints, solutions, lowers,
+      uppers, cs, info);
+}
+
+bool CglCachedCutGenerator::mayGenerateRowCutsInTree() const
+{
+  return generator_ ? generator_->mayGenerateRowCutsInTree() : false;
+}
+
+bool CglCachedCutGenerator::needsOptimalBasis() const
+{
+  return generator_ ? generator_->needsOptimalBasis() : false;
+}
+
+bool CglCachedCutGenerator::needsOnlySolution() const
+{
+  return generator_ ? generator_->needsOnlySolution() : false;
+}
+
+bool CglCachedCutGenerator::needsOriginalModel() const
+{
+  return generator_ ? generator_->needsOriginalModel() : false;
+}
+
+int CglCachedCutGenerator::maximumLengthOfCutInTree() const
+{
+  return generator_ ? generator_->maximumLengthOfCutInTree() : COIN_INT_MAX;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
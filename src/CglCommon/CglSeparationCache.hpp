@@ -0,0 +1,188 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglSeparationCache_H
+#define CglSeparationCache_H
+
+#include "OsiCuts.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CglConfig.h"
+#include "CglTreeInfo.hpp"
+#include "CglCutGenerator.hpp"
+
+/** Cuts found earlier by one cut generator, keyed by the LP state they
+    were found at - solution, column and row bounds, matrix (dimensions,
+    number of elements and a hash of elements and row indices), inTree,
+    options, level and pass from CglTreeInfo and (if wanted) basis.
+    As pass is in the key, a hit needs the same state at the same pass -
+    e.g. a node revisited or a generator called twice in one pass.
+    Two matrices with the same hash would be taken as equal; everything
+    else in the key is compared exactly, the key hash just saves time.  At most maximumEntries results
+    are kept and the least recently used is dropped.
+    Only cuts are saved, so a generator which has other side effects
+    (fixing information, strengthened rows) should not use one.
+    If basis is wanted but solver can not give one nothing is found or
+    saved.
+*/
+class CGLLIB_EXPORT CglSeparationCache {
+public:
+  /// Default constructor
+  CglSeparationCache(int maximumEntries = 4);
+  /// Copy constructor
+  CglSeparationCache(const CglSeparationCache &);
+  /// Assignment operator
+  CglSeparationCache &operator=(const CglSeparationCache &rhs);
+  /// Destructor
+  ~CglSeparationCache();
+  /** Returns cuts saved for current state of si or NULL.
+      withBasis says if basis is part of state - if it is and si has
+      no basis NULL is returned and following add does nothing. */
+  const OsiCuts *find(const OsiSolverInterface &si, const CglTreeInfo &info,
+    bool withBasis);
+  /** Saves cuts for state given to last find (generators may change
+      solver while working) - replacing least recently used result if full.
+      Does nothing if last find could not make a key. */
+  void add(const OsiCuts &cuts);
+  /// Forgets all saved results
+  void clear();
+  /// Maximum number of results kept
+  inline int maximumEntries() const
+  {
+    return maximumEntries_;
+  }
+  /// Number of results kept
+  inline int numberEntries() const
+  {
+    return numberEntries_;
+  }
+  /// Number of times find gave cuts
+  inline int numberHits() const
+  {
+    return numberHits_;
+  }
+  /// Number of times find gave NULL
+  inline int numberMisses() const
+  {
+    return numberMisses_;
+  }
+
+private:
+  /** Puts current state into key_ and hash_ - returns false (and
+      sets keyLength_ to 0) if basis wanted and not available */
+  bool makeKey(const OsiSolverInterface &si, const CglTreeInfo &info,
+    bool withBasis);
+  void gutsOfDelete();
+  void gutsOfCopy(const CglSeparationCache &rhs);
+  /// Maximum number of results kept
+  int maximumEntries_;
+  /// Number of results kept
+  int numberEntries_;
+  /// Counter for least recently used
+  int clock_;
+  /// Number of times find gave cuts
+  int numberHits_;
+  /// Number of times find gave NULL
+  int numberMisses_;
+  /// Key of each entry
+  double **entryKey_;
+  /// Length of key of each entry
+  int *entryLength_;
+  /// Hash of key of each entry
+  unsigned int *entryHash_;
+  /// When each entry was last used
+  int *entryUsed_;
+  /// Cuts for each entry
+  OsiCuts *entryCuts_;
+  /// Key for current state
+  double *key_;
+  /// Length of key for current state
+  int keyLength_;
+  /// Space in key_
+  int keySize_;
+  /// Hash of key for current state
+  unsigned int hash_;
+};
+
+/** Cut generator which gives cuts of another generator, reusing
+    results kept in a CglSeparationCache.  The cache is kept here
+    rather than in CglCutGenerator so generators are unchanged.
+    Cuts are the same as from the generator on its own as long as it
+    only adds cuts to cs (and does not look at cuts already there).
+*/
+class CGLLIB_EXPORT CglCachedCutGenerator : public CglCutGenerator {
+public:
+  /**@name Generate Cuts */
+  //@{
+  /** Generate cuts from generator - if cuts were found earlier at
+      exactly the same LP state (and same level and pass in info - see
+      CglSeparationCache) they are given again without calling it.
+  */
+  virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+    const CglTreeInfo info = CglTreeInfo());
+  /// Generate cuts for several points - passed on to generator (no caching)
+  virtual void generateCutsMulti(const OsiSolverInterface &si,
+    int numberPoints, const double *const *solutions,
+    const double *const *lowers, const double *const *uppers,
+    OsiCuts *cs, const CglTreeInfo info = CglTreeInfo());
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglCachedCutGenerator();
+  /** Constructor from generator (which is cloned) keeping at most
+      maximumEntries results */
+  CglCachedCutGenerator(const CglCutGenerator &generator,
+    int maximumEntries = 4);
+  /// Copy constructor
+  CglCachedCutGenerator(const CglCachedCutGenerator &);
+  /// Clone
+  virtual CglCutGenerator *clone() const;
+  /// Assignment operator
+  CglCachedCutGenerator &operator=(const CglCachedCutGenerator &rhs);
+  /// Destructor
+  virtual ~CglCachedCutGenerator();
+  /// Refresh generator and forget saved results
+  virtual void refreshSolver(OsiSolverInterface *solver);
+  //@}
+
+  /**@name Gets and Sets */
+  //@{
+  /// Generator (NULL if none)
+  inline CglCutGenerator *generator() const
+  {
+    return generator_;
+  }
+  /// Cache of separation results
+  inline const CglSeparationCache &separationCache() const
+  {
+    return cache_;
+  }
+  /// Forget all saved results
+  inline void clearCache()
+  {
+    cache_.clear();
+  }
+  /// As generator
+  virtual bool mayGenerateRowCutsInTree() const;
+  /// As generator
+  virtual bool needsOptimalBasis() const;
+  /// As generator
+  virtual bool needsOnlySolution() const;
+  /// As generator
+  virtual bool needsOriginalModel() const;
+  /// As generator
+  virtual int maximumLengthOfCutInTree() const;
+  //@}
+
+private:
+  /// Generator
+  CglCutGenerator *generator_;
+  /// Saved results
+  CglSeparationCache cache_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,199 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#include "CoinPragma.hpp"
+#include "CglSolutionDigest.hpp"
+#include "CglTreeInfo.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+
+// Default constructor
+CglSolutionDigest::CglSolutionDigest()
+  : solver_(NULL)
+  , objectiveValue_(0.0)
+  , iterationCount_(-1)
+  , level_(-1)
+  , pass_(-1)
+  , integerTolerance_(0.0)
+  , fractional_(NULL)
+  , fractionality_(NULL)
+  , columnStatus_(NULL)
+  , rowSlack_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberFractional_(0)
+{
+}
+// Constructor from solver
+CglSolutionDigest::CglSolutionDigest(const OsiSolverInterface &si,
+  const CglTreeInfo &info, double integerTolerance)
+  : solver_(NULL)
+  , objectiveValue_(0.0)
+  , iterationCount_(-1)
+  , level_(-1)
+  , pass_(-1)
+  , integerTolerance_(0.0)
+  , fractional_(NULL)
+  , fractionality_(NULL)
+  , columnStatus_(NULL)
+  , rowSlack_(NULL)
+  , numberColumns_(0)
+  , numberRows_(0)
+  , numberFractional_(0)
+{
+  compute(si, info, integerTolerance);
+}
+// Copy constructor
+CglSolutionDigest::CglSolutionDigest(const CglSolutionDigest &rhs)
+{
+  gutsOfCopy(rhs);
+}
+// Assignment operator
+CglSolutionDigest &
+CglSolutionDigest::operator=(const CglSolutionDigest &rhs)
+{
+  if (this != &rhs) {
+    gutsOfDelete();
+    gutsOfCopy(rhs);
+  }
+  return *this;
+}
+// Destructor
+CglSolutionDigest::~CglSolutionDigest()
+{
+  gutsOfDelete();
+}
+// Frees arrays
+void CglSolutionDigest::gutsOfDelete()
+{
+  delete[] fractional_;
+  delete[] fractionality_;
+  delete[] columnStatus_;
+  delete[] rowSlack_;
+  fractional_ = NULL;
+  fractionality_ = NULL;
+  columnStatus_ = NULL;
+  rowSlack_ = NULL;
+  numberColumns_ = 0;
+  numberRows_ = 0;
+  numberFractional_ = 0;
+  solver_ = NULL;
+}
+// Copies arrays
+void CglSolutionDigest::gutsOfCopy(const CglSolutionDigest &rhs)
+{
+  solver_ = rhs.solver_;
+  objectiveValue_ = rhs.objectiveValue_;
+  iterationCount_ = rhs.iterationCount_;
+  level_ = rhs.level_;
+  pass_ = rhs.pass_;
+  integerTolerance_ = rhs.integerTolerance_;
+  numberColumns_ = rhs.numberColumns_;
+  numberRows_ = rhs.numberRows_;
+  numberFractional_ = rhs.numberFractional_;
+  fractional_ = CoinCopyOfArray(rhs.fractional_, numberFractional_);
+  fractionality_ = CoinCopyOfArray(rhs.fractionality_, numberColumns_);
+  columnStatus_ = CoinCopyOfArray(rhs.columnStatus_, numberColumns_);
+  rowSlack_ = CoinCopyOfArray(rhs.rowSlack_, numberRows_);
+}
+// (Re)computes digest
+int CglSolutionDigest::compute(const OsiSolverInterface &si,
+  const CglTreeInfo &info, double integerTolerance)
+{
+  int numberColumns = si.getNumCols();
+  int numberRows = si.getNumRows();
+  if (numberColumns != numberColumns_ || numberRows != numberRows_) {
+    gutsOfDelete();
+    numberColumns_ = numberColumns;
+    numberRows_ = numberRows;
+    fractional_ = new int[numberColumns_];
+    fractionality_ = new double[numberColumns_];
+    columnStatus_ = new char[numberColumns_];
+    rowSlack_ = new double[numberRows_];
+  }
+  solver_ = &si;
+  objectiveValue_ = si.getObjValue();
+  iterationCount_ = si.getIterationCount();
+  level_ = info.level;
+  pass_ = info.pass;
+  integerTolerance_ = integerTolerance;
+  const double *solution = si.getColSolution();
+  const double *lower = si.getColLower();
+  const double *upper = si.getColUpper();
+  double primalTolerance;
+  si.getDblParam(OsiPrimalTolerance, primalTolerance);
+  // sort on minus fractionality so most fractional first
+  double *sort = new double[numberColumns_];
+  numberFractional_ = 0;
+  for (int i = 0; i < numberColumns_; i++) {
+    double value = solution[i];
+    char status = 0;
+    if (upper[i] - lower[i] < primalTolerance)
+      status = 3;
+    else if (value < lower[i] + primalTolerance)
+      status = 1;
+    else if (value > upper[i] - primalTolerance)
+      status = 2;
+    columnStatus_[i] = status;
+    double away = 0.0;
+    if (si.isInteger(i)) {
+      away = fabs(value - floor(value + 0.5));
+      if (away > integerTolerance) {
+        sort[numberFractional_] = -away;
+        fractional_[numberFractional_++] = i;
+      } else {
+        away = 0.0;
+      }
+    }
+    fractionality_[i] = away;
+  }
+  CoinSort_2(sort, sort + numberFractional_, fractional_);
+  delete[] sort;
+  const double *rowActivity = si.getRowActivity();
+  const double *rowLower = si.getRowLower();
+  const double *rowUpper = si.getRowUpper();
+  for (int i = 0; i < numberRows_; i++) {
+    double value = rowActivity[i];
+    rowSlack_[i] = CoinMin(value - rowLower[i], rowUpper[i] - value);
+  }
+  return numberFractional_;
+}
+// True if digest was computed from si at this node and pass
+bool CglSolutionDigest::matches(const OsiSolverInterface &si,
+  const CglTreeInfo &info) const
+{
+  return solver_ == &si && level_ == info.level && pass_ == info.pass
+    && numberColumns_ == si.getNumCols() && numberRows_ == si.getNumRows()
+    && iterationCount_ == si.getIterationCount()
+    && objectiveValue_ == si.getObjValue();
+}
+// True if shared digest shows no integer more than away from integer
+bool CglSolutionDigest::noneFractional(const OsiSolverInterface &si,
+  const CglTreeInfo &info, double away)
+{
+  const CglSolutionDigest *digest = info.solutionDigest;
+  return digest && away >= digest->integerTolerance_
+    && digest->matches(si, info) && !digest->numberFractional(away);
+}
+// Number of fractional integer variables with fractionality > away
+int CglSolutionDigest::numberFractional(double away) const
+{
+  // fractional_ is in decreasing order of fractionality
+  int low = 0;
+  int high = numberFractional_;
+  while (low < high) {
+    int mid = (low + high) >> 1;
+    if (fractionality_[fractional_[mid]] > away)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return low;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
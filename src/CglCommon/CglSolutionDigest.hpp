@@ -0,0 +1,128 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglSolutionDigest_H
+#define CglSolutionDigest_H
+
+#include "OsiSolverInterface.hpp"
+#include "CglConfig.h"
+
+class CglTreeInfo;
+
+/** Summary of an LP solution which can be computed once and shared by
+    cut generators (through CglTreeInfo) so each one does not have to
+    scan all columns to find fractional integers.
+
+    A digest is identified by the solver it was computed from, its size,
+    objective value and iteration count and the level and pass of the
+    CglTreeInfo given to compute, so checking is constant time.  The
+    caller must compute again if it changes the solver within a pass
+    (e.g. changes bounds without resolving) as that is not seen. */
+class CGLLIB_EXPORT CglSolutionDigest {
+public:
+  /// Default constructor
+  CglSolutionDigest();
+  /// Constructor from solver at node and pass given by info
+  CglSolutionDigest(const OsiSolverInterface &si, const CglTreeInfo &info,
+    double integerTolerance = 1.0e-9);
+  /// Copy constructor
+  CglSolutionDigest(const CglSolutionDigest &);
+  /// Assignment operator
+  CglSolutionDigest &operator=(const CglSolutionDigest &rhs);
+  /// Destructor
+  ~CglSolutionDigest();
+  /** (Re)computes digest from current solution in si at node and pass
+      given by info.  Returns number of fractional integer variables */
+  int compute(const OsiSolverInterface &si, const CglTreeInfo &info,
+    double integerTolerance = 1.0e-9);
+  /** True if digest was computed from si at same level and pass of info
+      and si has same size, objective value and iteration count. */
+  bool matches(const OsiSolverInterface &si, const CglTreeInfo &info) const;
+  /** True if info has a digest which matches si and which shows no
+      integer variable more than away from an integer.  Generators which
+      can only cut off fractional integers use this to return at once.
+      False if away is less than tolerance of digest. */
+  static bool noneFractional(const OsiSolverInterface &si,
+    const CglTreeInfo &info, double away);
+  /// Number of fractional integer variables
+  inline int numberFractional() const
+  {
+    return numberFractional_;
+  }
+  /** Number of fractional integer variables with fractionality
+      greater than away (these are first in fractional()) */
+  int numberFractional(double away) const;
+  /// Fractional integer variables - most fractional first
+  inline const int *fractional() const
+  {
+    return fractional_;
+  }
+  /// Distance to nearest integer for each column (0.0 if not integer)
+  inline const double *fractionality() const
+  {
+    return fractionality_;
+  }
+  /** Status of each column -
+      0 strictly between bounds, 1 at lower, 2 at upper, 3 fixed */
+  inline const char *columnStatus() const
+  {
+    return columnStatus_;
+  }
+  /// Distance of row activity to nearest bound for each row
+  inline const double *rowSlack() const
+  {
+    return rowSlack_;
+  }
+  /// Number of columns
+  inline int numberColumns() const
+  {
+    return numberColumns_;
+  }
+  /// Number of rows
+  inline int numberRows() const
+  {
+    return numberRows_;
+  }
+  /// Tolerance used to decide if integer variable is fractional
+  inline double integerTolerance() const
+  {
+    return integerTolerance_;
+  }
+
+private:
+  /// Frees arrays
+  void gutsOfDelete();
+  /// Copies arrays
+  void gutsOfCopy(const CglSolutionDigest &rhs);
+  /// Solver digest was computed from (only used for checking)
+  const OsiSolverInterface *solver_;
+  /// Objective value when computed
+  double objectiveValue_;
+  /// Iteration count of solver when computed
+  int iterationCount_;
+  /// Level of tree info when computed
+  int level_;
+  /// Pass of tree info when computed
+  int pass_;
+  /// Tolerance used to decide if integer variable is fractional
+  double integerTolerance_;
+  /// Fractional integer variables - most fractional first
+  int *fractional_;
+  /// Distance to nearest integer for each column
+  double *fractionality_;
+  /// Status of each column
+  char *columnStatus_;
+  /// Distance of row activity to nearest bound
+  double *rowSlack_;
+  /// Number of columns
+  int numberColumns_;
+  /// Number of rows
+  int numberRows_;
+  /// Number of fractional integer variables
+  int numberFractional_;
+};
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -29,6 +29,9 @@ CglTreeInfo::CglTreeInfo()
   , originalColumns(NULL)
   , strengthenRow(NULL)
   , randomNumberGenerator(NULL)
+  , solutionDigest(NULL)
+  , components(NULL)
+  , impliedIntegers(NULL)
 {
 }
 
@@ -44,6 +47,9 @@ CglTreeInfo::CglTreeInfo(const CglTreeInfo &rhs)
   , originalColumns(rhs.originalColumns)
   , strengthenRow(rhs.strengthenRow)
   , randomNumberGenerator(rhs.randomNumberGenerator)
+  , solutionDigest(rhs.solutionDigest)
+  , components(rhs.components)
+  , impliedIntegers(rhs.impliedIntegers)
 {
 }
 // Clone
@@ -69,6 +75,9 @@ CglTreeInfo::operator=(const CglTreeInfo &rhs)
     originalColumns = rhs.originalColumns;
     strengthenRow = rhs.strengthenRow;
     randomNumberGenerator = rhs.randomNumberGenerator;
+    solutionDigest = rhs.solutionDigest;
+    components = rhs.components;
+    impliedIntegers = rhs.impliedIntegers;
   }
   return *this;
 }
@@ -91,6 +100,12 @@ CglTreeProbingInfo::CglTreeProbingInfo()
   , numberIntegers_(0)
   , maximumEntries_(0)
   , numberEntries_(-1)
+  , cliqueStart_(NULL)
+  , cliqueEntry_(NULL)
+  , cliqueType_(NULL)
+  , cliqueByVariableStart_(NULL)
+  , cliqueByVariable_(NULL)
+  , numberCliques_(0)
 {
 }
 // Constructor from model
@@ -106,6 +121,12 @@ CglTreeProbingInfo::CglTreeProbingInfo(const OsiSolverInterface *model)
   , numberIntegers_(0)
   , maximumEntries_(0)
   , numberEntries_(-1)
+  , cliqueStart_(NULL)
+  , cliqueEntry_(NULL)
+  , cliqueType_(NULL)
+  , cliqueByVariableStart_(NULL)
+  , cliqueByVariable_(NULL)
+  , numberCliques_(0)
 {
   numberVariables_ = model->getNumCols();
   // Too many ... but
@@ -146,6 +167,12 @@ CglTreeProbingInfo::CglTreeProbingInfo(const CglTreeProbingInfo &rhs)
   , numberIntegers_(rhs.numberIntegers_)
   , maximumEntries_(rhs.maximumEntries_)
   , numberEntries_(rhs.numberEntries_)
+  , cliqueStart_(NULL)
+  , cliqueEntry_(NULL)
+  , cliqueType_(NULL)
+  , cliqueByVariableStart_(NULL)
+  , cliqueByVariable_(NULL)
+  , numberCliques_(0)
 {
   if (numberVariables_) {
     fixEntry_ = new CliqueEntry[maximumEntries_];
@@ -161,6 +188,7 @@ CglTreeProbingInfo::CglTreeProbingInfo(const CglTreeProbingInfo &rhs)
     integerVariable_ = CoinCopyOfArray(rhs.integerVariable_, numberIntegers_);
     backward_ = CoinCopyOfArray(rhs.backward_, numberVariables_);
   }
+  copyCliques(rhs);
 }
 // Clone
 CglTreeInfo *
@@ -211,6 +239,8 @@ CglTreeProbingInfo::operator=(const CglTreeProbingInfo &rhs)
       backward_ = NULL;
       fixingEntry_ = NULL;
     }
+    deleteCliques();
+    copyCliques(rhs);
   }
   return *this;
 }
@@ -224,6 +254,101 @@ CglTreeProbingInfo::~CglTreeProbingInfo()
   delete[] integerVariable_;
   delete[] backward_;
   delete[] fixingEntry_;
+  deleteCliques();
+}
+// Frees stored cliques
+void CglTreeProbingInfo::deleteCliques()
+{
+  delete[] cliqueStart_;
+  delete[] cliqueEntry_;
+  delete[] cliqueType_;
+  delete[] cliqueByVariableStart_;
+  delete[] cliqueByVariable_;
+  cliqueStart_ = NULL;
+  cliqueEntry_ = NULL;
+  cliqueType_ = NULL;
+  cliqueByVariableStart_ = NULL;
+  cliqueByVariable_ = NULL;
+  numberCliques_ = 0;
+}
+// Copies stored cliques
+void CglTreeProbingInfo::copyCliques(const CglTreeProbingInfo &rhs)
+{
+  numberCliques_ = rhs.numberCliques_;
+  if (numberCliques_) {
+    CoinBigIndex numberEntries = rhs.cliqueStart_[numberCliques_];
+    cliqueStart_ = CoinCopyOfArray(rhs.cliqueStart_, numberCliques_ + 1);
+    cliqueEntry_ = CoinCopyOfArray(rhs.cliqueEntry_, numberEntries);
+    cliqueType_ = CoinCopyOfArray(rhs.cliqueType_, numberCliques_);
+    cliqueByVariableStart_ = CoinCopyOfArray(rhs.cliqueByVariableStart_, numberIntegers_ + 1);
+    cliqueByVariable_ = CoinCopyOfArray(rhs.cliqueByVariable_, numberEntries);
+  }
+}
+// Stores a clique table
+void CglTreeProbingInfo::setCliques(int numberCliques, const CoinBigIndex *cliqueStart,
+  const CliqueEntry *entries)
+{
+  deleteCliques();
+  if (!numberCliques || !backward_)
+    return;
+  CoinBigIndex numberEntries = cliqueStart[numberCliques];
+  cliqueStart_ = new CoinBigIndex[numberCliques + 1];
+  cliqueEntry_ = new CliqueEntry[numberEntries];
+  cliqueType_ = new char[numberCliques];
+  // translate to 0-1 sequence - drop any cliques which are no longer all 0-1
+  CoinBigIndex put = 0;
+  cliqueStart_[0] = 0;
+  for (int iClique = 0; iClique < numberCliques; iClique++) {
+    CoinBigIndex start = put;
+    CoinBigIndex j;
+    for (j = cliqueStart[iClique]; j < cliqueStart[iClique + 1]; j++) {
+      int iColumn = sequenceInCliqueEntry(entries[j]);
+      int jColumn = iColumn < numberVariables_ ? backward_[iColumn] : -1;
+      if (jColumn < 0)
+        break;
+      cliqueEntry_[put] = entries[j];
+      setSequenceInCliqueEntry(cliqueEntry_[put++], jColumn);
+    }
+    if (j < cliqueStart[iClique + 1]) {
+      put = start;
+      continue;
+    }
+    cliqueType_[numberCliques_] = 'S';
+    cliqueStart_[++numberCliques_] = put;
+  }
+  if (numberCliques_)
+    createCliquesByVariable();
+  else
+    deleteCliques();
+}
+// Creates cliques for each variable from stored cliques
+void CglTreeProbingInfo::createCliquesByVariable()
+{
+  delete[] cliqueByVariableStart_;
+  delete[] cliqueByVariable_;
+  cliqueByVariableStart_ = new int[numberIntegers_ + 1];
+  CoinZeroN(cliqueByVariableStart_, numberIntegers_ + 1);
+  CoinBigIndex numberEntries = cliqueStart_[numberCliques_];
+  for (CoinBigIndex j = 0; j < numberEntries; j++)
+    cliqueByVariableStart_[sequenceInCliqueEntry(cliqueEntry_[j])]++;
+  int n = 0;
+  for (int i = 0; i < numberIntegers_; i++) {
+    int count = cliqueByVariableStart_[i];
+    cliqueByVariableStart_[i] = n;
+    n += count;
+  }
+  cliqueByVariableStart_[numberIntegers_] = n;
+  cliqueByVariable_ = new int[CoinMax(n, 1)];
+  for (int iClique = 0; iClique < numberCliques_; iClique++) {
+    for (CoinBigIndex j = cliqueStart_[iClique]; j < cliqueStart_[iClique + 1]; j++) {
+      int jColumn = sequenceInCliqueEntry(cliqueEntry_[j]);
+      cliqueByVariable_[cliqueByVariableStart_[jColumn]++] = iClique;
+    }
+  }
+  // put starts back
+  for (int i = numberIntegers_; i > 0; i--)
+    cliqueByVariableStart_[i] = cliqueByVariableStart_[i - 1];
+  cliqueByVariableStart_[0] = 0;
 }
 static int outDupsEtc(int numberIntegers, int &numberCliques, int &numberMatrixCliques,
   CoinBigIndex *&cliqueStart, char *&cliqueType, CliqueEntry *&entry,
@@ -512,6 +637,57 @@ static int outDupsEtc(int numberIntegers, int &numberCliques, int &numberMatrixC
   else
     return -1;
 }
+// Makes sure there is room for one more clique with extra entries
+static void roomForClique(int numberCliques, int &maximumCliques,
+  CoinBigIndex numberEntries, CoinBigIndex &maximumEntries, CoinBigIndex extra,
+  CoinBigIndex *&cliqueStart, CliqueEntry *&entry, char *&cliqueType,
+  int *&whichClique)
+{
+  if (numberEntries + extra > maximumEntries) {
+    maximumEntries = CoinMax(numberEntries + extra, (maximumEntries * 12) / 10 + 100);
+    CliqueEntry *temp = new CliqueEntry[maximumEntries];
+    memcpy(temp, entry, numberEntries * sizeof(CliqueEntry));
+    delete[] entry;
+    entry = temp;
+    if (whichClique) {
+      int *tempI = new int[maximumEntries];
+      memcpy(tempI, whichClique, numberEntries * sizeof(int));
+      delete[] whichClique;
+      whichClique = tempI;
+    }
+  }
+  if (numberCliques == maximumCliques) {
+    maximumCliques = (maximumCliques * 12) / 10 + 100;
+    CoinBigIndex *temp = new CoinBigIndex[maximumCliques + 1];
+    memcpy(temp, cliqueStart, (numberCliques + 1) * sizeof(CoinBigIndex));
+    delete[] cliqueStart;
+    cliqueStart = temp;
+    char *tempT = new char[maximumCliques];
+    memcpy(tempT, cliqueType, numberCliques);
+    delete[] cliqueType;
+    cliqueType = tempT;
+  }
+}
+// Adds clique of two from pair of implications
+static void addPairClique(int iColumn, bool iOne, int jColumn, bool jOne,
+  int &numberCliques, int &maximumCliques,
+  CoinBigIndex &numberEntries, CoinBigIndex &maximumEntries,
+  CoinBigIndex *&cliqueStart, CliqueEntry *&entry, char *&cliqueType)
+{
+  int *noWhich = NULL;
+  roomForClique(numberCliques, maximumCliques, numberEntries,
+    maximumEntries, 2, cliqueStart, entry, cliqueType, noWhich);
+  CliqueEntry temp;
+  setOneFixesInCliqueEntry(temp, iOne);
+  setSequenceInCliqueEntry(temp, iColumn);
+  entry[numberEntries++] = temp;
+  setOneFixesInCliqueEntry(temp, jOne);
+  setSequenceInCliqueEntry(temp, jColumn);
+  entry[numberEntries++] = temp;
+  // slack
+  cliqueType[numberCliques] = 'S';
+  cliqueStart[++numberCliques] = numberEntries;
+}
 OsiSolverInterface *
 CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
   int numberExtraCliques, const CoinBigIndex *starts,
@@ -527,15 +703,77 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
     alwaysDo = true;
     numberExtraCliques = 0;
   }
+  int numberProbingCliques = findCliques(si, numberExtraCliques, starts, entries, type);
+  printf("%d matrix cliques and %d found by probing\n", numberCliques_ - numberProbingCliques, numberProbingCliques);
+  OsiSolverInterface *newSolver = NULL;
+  if (numberProbingCliques > 0 || alwaysDo) {
+    int numberRows = si.getNumRows();
+    newSolver = si.clone();
+    // Delete all rows
+    CoinBigIndex *start = new CoinBigIndex[CoinMax(numberRows, numberCliques_ + 1)];
+    int i;
+    int *start2 = reinterpret_cast< int * >(start);
+    for (i = 0; i < numberRows; i++)
+      start2[i] = i;
+    newSolver->deleteRows(numberRows, start2);
+    start[0] = 0;
+    CoinBigIndex numberElements = numberCliques_ ? cliqueStart_[numberCliques_] : 0;
+    int *column = new int[numberElements];
+    double *element = new double[numberElements];
+    double *lower = new double[numberCliques_];
+    double *upper = new double[numberCliques_];
+    numberElements = 0;
+    for (int iClique = 0; iClique < numberCliques_; iClique++) {
+      double rhs = 1.0;
+      for (CoinBigIndex i = cliqueStart_[iClique]; i < cliqueStart_[iClique + 1]; i++) {
+        CliqueEntry eI = cliqueEntry_[i];
+        int iColumn = integerVariable_[sequenceInCliqueEntry(eI)];
+        column[numberElements] = iColumn;
+        if (oneFixesInCliqueEntry(eI)) {
+          element[numberElements++] = 1.0;
+        } else {
+          element[numberElements++] = -1.0;
+          rhs -= 1.0;
+        }
+      }
+      start[iClique + 1] = numberElements;
+      assert(cliqueType_[iClique] == 'S' || cliqueType_[iClique] == 'E');
+      if (cliqueType_[iClique] == 'S')
+        lower[iClique] = -COIN_DBL_MAX;
+      else
+        lower[iClique] = rhs;
+      upper[iClique] = rhs;
+    }
+    newSolver->addRows(numberCliques_, start, column, element, lower, upper);
+    delete[] start;
+    delete[] column;
+    delete[] element;
+    delete[] lower;
+    delete[] upper;
+  }
+  return newSolver;
+}
+// Finds cliques and keeps them as stored cliques
+int CglTreeProbingInfo::findCliques(const OsiSolverInterface &si,
+  int numberExtraCliques, const CoinBigIndex *starts,
+  const CliqueEntry *entries, const char *type)
+{
+  deleteCliques();
+  convert();
+  if (!numberIntegers_)
+    return 0;
   bool printit = false;
   int numberCliques = 0;
+  int maximumCliques = numberExtraCliques + 100;
   CoinBigIndex numberEntries = 0;
-  CoinBigIndex *cliqueStart = NULL;
-  CliqueEntry *entry = NULL;
-  char *cliqueType = NULL;
+  CoinBigIndex maximumEntries = (numberExtraCliques ? starts[numberExtraCliques] : 0) + 200;
+  CoinBigIndex *cliqueStart = new CoinBigIndex[maximumCliques + 1];
+  cliqueStart[0] = 0;
+  CliqueEntry *entry = new CliqueEntry[maximumEntries];
+  char *cliqueType = new char[maximumCliques];
+  int *whichClique = NULL;
   int *whichP = new int[numberIntegers_];
   int *whichM = new int[numberIntegers_];
-  int *whichClique = NULL;
   int numberRows = si.getNumRows();
   int numberMatrixCliques = 0;
   const CoinPackedMatrix *rowCopy = si.getMatrixByRow();
@@ -549,360 +787,258 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
   const double *upper = si.getColUpper();
   const double *rowLower = si.getRowLower();
   const double *rowUpper = si.getRowUpper();
-  for (int iPass = 0; iPass < 2; iPass++) {
-    if (iPass) {
-      CoinBigIndex numberExtraEntries = 0;
-      if (numberExtraCliques)
-        numberExtraEntries = starts[numberExtraCliques];
-      cliqueStart = new CoinBigIndex[numberCliques + 1 + numberExtraCliques];
-      cliqueStart[0] = 0;
-      entry = new CliqueEntry[numberEntries + numberExtraEntries];
-      cliqueType = new char[numberCliques + numberExtraCliques];
-      whichClique = new int[numberEntries + numberExtraEntries];
-      numberCliques = 0;
-      numberEntries = 0;
+  // one pass through rows - cliques go straight into store
+  for (iRow = 0; iRow < numberRows; iRow++) {
+    int numberP1 = 0, numberM1 = 0;
+    int numberTotal = 0;
+    CoinBigIndex j;
+    double upperValue = rowUpper[iRow];
+    double lowerValue = rowLower[iRow];
+    bool good = true;
+    for (j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++) {
+      int iColumn = column[j];
+      double value = elementByRow[j];
+      if (upper[iColumn] - lower[iColumn] < 1.0e-8) {
+        // fixed
+        upperValue -= lower[iColumn] * value;
+        lowerValue -= lower[iColumn] * value;
+        continue;
+      } else if (backward_[iColumn] < 0) {
+        good = false;
+        break;
+      } else {
+        iColumn = backward_[iColumn];
+        numberTotal++;
+      }
+      if (fabs(value) != 1.0) {
+        good = false;
+      } else if (value > 0.0) {
+        assert(numberP1 < numberIntegers_);
+        whichP[numberP1++] = iColumn;
+      } else {
+        assert(numberM1 < numberIntegers_);
+        whichM[numberM1++] = iColumn;
+      }
     }
-#if 1
-    for (iRow = 0; iRow < numberRows; iRow++) {
-      int numberP1 = 0, numberM1 = 0;
-      int numberTotal = 0;
-      CoinBigIndex j;
-      double upperValue = rowUpper[iRow];
-      double lowerValue = rowLower[iRow];
-      bool good = true;
-      for (j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++) {
-        int iColumn = column[j];
-        double value = elementByRow[j];
-        if (upper[iColumn] - lower[iColumn] < 1.0e-8) {
-          // fixed
-          upperValue -= lower[iColumn] * value;
-          lowerValue -= lower[iColumn] * value;
-          continue;
-        } else if (backward_[iColumn] < 0) {
-          good = false;
-          break;
-        } else {
-          iColumn = backward_[iColumn];
-          numberTotal++;
+    int iUpper = static_cast< int >(floor(upperValue + 1.0e-5));
+    int iLower = static_cast< int >(ceil(lowerValue - 1.0e-5));
+    int state = 0;
+    if (upperValue < 1.0e6) {
+      if (iUpper == 1 - numberM1)
+        state = 1;
+      else if (iUpper == -numberM1)
+        state = 2;
+      else if (iUpper < -numberM1)
+        state = 3;
+      if (fabs(static_cast< double >(iUpper) - upperValue) > 1.0e-9)
+        state = -1;
+    }
+    if (!state && lowerValue > -1.0e6) {
+      if (-iLower == 1 - numberP1)
+        state = -1;
+      else if (-iLower == -numberP1)
+        state = -2;
+      else if (-iLower < -numberP1)
+        state = -3;
+      if (fabs(static_cast< double >(iLower) - lowerValue) > 1.0e-9)
+        state = -1;
+    }
+    if (numberP1 + numberM1 < 2)
+      state = -1;
+    if (good && state > 0) {
+      if (abs(state) == 3) {
+        // infeasible
+        printf("FFF Infeasible\n");
+        //feasible=false;
+        break;
+      } else if (abs(state) == 2) {
+        // we can fix all
+        //numberFixed += numberP1+numberM1;
+        printf("FFF can fix %d\n", numberP1 + numberM1);
+      } else {
+        roomForClique(numberCliques, maximumCliques, numberEntries,
+          maximumEntries, numberP1 + numberM1, cliqueStart, entry, cliqueType, whichClique);
+        for (j = 0; j < numberP1; j++) {
+          CliqueEntry temp;
+          setOneFixesInCliqueEntry(temp, true);
+          setSequenceInCliqueEntry(temp, whichP[j]);
+          entry[numberEntries++] = temp;
+        }
+        for (j = 0; j < numberM1; j++) {
+          CliqueEntry temp;
+          setOneFixesInCliqueEntry(temp, false);
+          setSequenceInCliqueEntry(temp, whichM[j]);
+          entry[numberEntries++] = temp;
         }
-        if (fabs(value) != 1.0) {
-          good = false;
-        } else if (value > 0.0) {
-          assert(numberP1 < numberIntegers_);
-          whichP[numberP1++] = iColumn;
-          ;
+        if (iLower != iUpper) {
+          // slack
+          cliqueType[numberCliques] = 'S';
         } else {
-          assert(numberM1 < numberIntegers_);
-          whichM[numberM1++] = iColumn;
+          cliqueType[numberCliques] = 'E';
         }
+        cliqueStart[++numberCliques] = numberEntries;
       }
-      int iUpper = static_cast< int >(floor(upperValue + 1.0e-5));
-      int iLower = static_cast< int >(ceil(lowerValue - 1.0e-5));
-      int state = 0;
-      if (upperValue < 1.0e6) {
-        if (iUpper == 1 - numberM1)
-          state = 1;
-        else if (iUpper == -numberM1)
-          state = 2;
-        else if (iUpper < -numberM1)
-          state = 3;
-        if (fabs(static_cast< double >(iUpper) - upperValue) > 1.0e-9)
-          state = -1;
-      }
-      if (!state && lowerValue > -1.0e6) {
-        if (-iLower == 1 - numberP1)
-          state = -1;
-        else if (-iLower == -numberP1)
-          state = -2;
-        else if (-iLower < -numberP1)
-          state = -3;
-        if (fabs(static_cast< double >(iLower) - lowerValue) > 1.0e-9)
-          state = -1;
-      }
-      if (numberP1 + numberM1 < 2)
-        state = -1;
-      if (good && state > 0) {
-        if (abs(state) == 3) {
-          // infeasible
-          printf("FFF Infeasible\n");
-          ;
-          //feasible=false;
-          break;
-        } else if (abs(state) == 2) {
-          // we can fix all
-          //numberFixed += numberP1+numberM1;
-          printf("FFF can fix %d\n", numberP1 + numberM1);
-        } else {
-          for (j = 0; j < numberP1; j++) {
-            int iColumn = whichP[j];
-            if (iPass) {
-              CliqueEntry temp;
-              setOneFixesInCliqueEntry(temp, true);
-              setSequenceInCliqueEntry(temp, iColumn);
-              entry[numberEntries] = temp;
-            }
-            numberEntries++;
-          }
-          for (j = 0; j < numberM1; j++) {
-            int iColumn = whichM[j];
-            if (iPass) {
-              CliqueEntry temp;
-              setOneFixesInCliqueEntry(temp, false);
-              setSequenceInCliqueEntry(temp, iColumn);
-              entry[numberEntries] = temp;
+    }
+  }
+  for (int iClique = 0; iClique < numberExtraCliques; iClique++) {
+    CoinBigIndex n = starts[iClique + 1] - starts[iClique];
+    roomForClique(numberCliques, maximumCliques, numberEntries,
+      maximumEntries, n, cliqueStart, entry, cliqueType, whichClique);
+    memcpy(entry + numberEntries, entries + starts[iClique], n * sizeof(CliqueEntry));
+    numberEntries += n;
+    cliqueType[numberCliques] = type[iClique];
+    cliqueStart[++numberCliques] = numberEntries;
+  }
+  numberMatrixCliques = numberCliques;
+  // find two cliques
+  int nFix = 0;
+  for (int iColumn = 0; iColumn < static_cast< int >(numberIntegers_); iColumn++) {
+    int j;
+    for (j = toZero_[iColumn]; j < toOne_[iColumn]; j++) {
+      int jColumn = sequenceInCliqueEntry(fixEntry_[j]);
+      // just look at ones beore (this also skips non 0-1)
+      if (jColumn < iColumn) {
+        int k;
+        for (k = toZero_[jColumn]; k < toOne_[jColumn]; k++) {
+          if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
+            if (oneFixesInCliqueEntry(fixEntry_[j])) {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to zero implies %d to one and %d to zero implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                //0-0 illegal
+                addPairClique(iColumn, false, jColumn, false, numberCliques, maximumCliques,
+                  numberEntries, maximumEntries, cliqueStart, entry, cliqueType);
+              } else {
+                if (printit)
+                  printf("%d to zero implies %d to one and %d to zero implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // jColumn is 1
+              }
+            } else {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to zero implies %d to zero and %d to zero implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn is 1
+              } else {
+                if (printit)
+                  printf("%d to zero implies %d to zero and %d to zero implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // jColumn=iColumn
+              }
             }
-            numberEntries++;
           }
-          if (iPass) {
-            if (iLower != iUpper) {
-              // slack
-              cliqueType[numberCliques] = 'S';
+        }
+        for (k = toOne_[jColumn]; k < toZero_[jColumn + 1]; k++) {
+          if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
+            if (oneFixesInCliqueEntry(fixEntry_[j])) {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to zero implies %d to one and %d to one implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; //iColumn is 1
+              } else {
+                if (printit)
+                  printf("%d to zero implies %d to one and %d to one implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn+jcolumn=1
+              }
             } else {
-              cliqueType[numberCliques] = 'E';
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to zero implies %d to zero and %d to one implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                // 0-1 illegal
+                addPairClique(iColumn, false, jColumn, true, numberCliques, maximumCliques,
+                  numberEntries, maximumEntries, cliqueStart, entry, cliqueType);
+              } else {
+                if (printit)
+                  printf("%d to zero implies %d to zero and %d to one implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // jColumn is 0
+              }
             }
-            cliqueStart[numberCliques + 1] = numberEntries;
           }
-          numberCliques++;
         }
       }
     }
-#endif
-    if (numberExtraCliques) {
-      CoinBigIndex numberExtraEntries = starts[numberExtraCliques];
-      memcpy(entry + numberEntries, entries, numberExtraEntries * sizeof(CliqueEntry));
-      for (int iClique = 0; iClique < numberExtraCliques; iClique++) {
-        cliqueType[numberCliques] = type[iClique];
-        numberCliques++;
-        cliqueStart[numberCliques] = starts[iClique] + numberEntries;
-      }
-      numberEntries += numberExtraEntries;
-    }
-    numberMatrixCliques = numberCliques;
-    //int size = toZero_[numberIntegers_];
-    //char * used = new char [size];
-    //memset(used,0,size);
-    // find two cliques
-    int nFix = 0;
-    for (int iColumn = 0; iColumn < static_cast< int >(numberIntegers_); iColumn++) {
-      int j;
-      for (j = toZero_[iColumn]; j < toOne_[iColumn]; j++) {
-        int jColumn = sequenceInCliqueEntry(fixEntry_[j]);
-        // just look at ones beore (this also skips non 0-1)
-        if (jColumn < iColumn) {
-          int k;
-          for (k = toZero_[jColumn]; k < toOne_[jColumn]; k++) {
-            if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
-              if (oneFixesInCliqueEntry(fixEntry_[j])) {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to one and %d to zero implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  //0-0 illegal
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, false);
-                    setSequenceInCliqueEntry(temp, iColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, false);
-                    setSequenceInCliqueEntry(temp, jColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    // slack
-                    cliqueType[numberCliques] = 'S';
-                    cliqueStart[numberCliques + 1] = numberEntries;
-                  }
-                  numberCliques++;
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to one and %d to zero implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // jColumn is 1
-                }
+    for (j = toOne_[iColumn]; j < toZero_[iColumn + 1]; j++) {
+      int jColumn = sequenceInCliqueEntry(fixEntry_[j]);
+      if (jColumn < iColumn) {
+        int k;
+        for (k = toZero_[jColumn]; k < toOne_[jColumn]; k++) {
+          if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
+            if (oneFixesInCliqueEntry(fixEntry_[j])) {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to one implies %d to one and %d to zero implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // jColumn is 1
               } else {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to zero and %d to zero implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn is 1
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to zero and %d to zero implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // jColumn=iColumn
-                }
+                if (printit)
+                  printf("%d to one implies %d to one and %d to zero implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                // 1-0 illegal
+                addPairClique(iColumn, true, jColumn, false, numberCliques, maximumCliques,
+                  numberEntries, maximumEntries, cliqueStart, entry, cliqueType);
               }
-            }
-          }
-          for (k = toOne_[jColumn]; k < toZero_[jColumn + 1]; k++) {
-            if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
-              if (oneFixesInCliqueEntry(fixEntry_[j])) {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to one and %d to one implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; //iColumn is 1
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to one and %d to one implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn+jcolumn=1
-                }
+            } else {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to one implies %d to zero and %d to zero implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn+jColumn=1
               } else {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to zero and %d to one implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  // 0-1 illegal
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, false);
-                    setSequenceInCliqueEntry(temp, iColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, true);
-                    setSequenceInCliqueEntry(temp, jColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    // slack
-                    cliqueType[numberCliques] = 'S';
-                    cliqueStart[numberCliques + 1] = numberEntries;
-                  }
-                  numberCliques++;
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to zero implies %d to zero and %d to one implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // jColumn is 0
-                }
+                if (printit)
+                  printf("%d to one implies %d to zero and %d to zero implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn is 0
               }
             }
           }
         }
-      }
-      for (j = toOne_[iColumn]; j < toZero_[iColumn + 1]; j++) {
-        int jColumn = sequenceInCliqueEntry(fixEntry_[j]);
-        if (jColumn < iColumn) {
-          int k;
-          for (k = toZero_[jColumn]; k < toOne_[jColumn]; k++) {
-            if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
-              if (oneFixesInCliqueEntry(fixEntry_[j])) {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to one and %d to zero implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // jColumn is 1
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to one and %d to zero implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  // 1-0 illegal
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, true);
-                    setSequenceInCliqueEntry(temp, iColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, false);
-                    setSequenceInCliqueEntry(temp, jColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    // slack
-                    cliqueType[numberCliques] = 'S';
-                    cliqueStart[numberCliques + 1] = numberEntries;
-                  }
-                  numberCliques++;
-                }
+        for (k = toOne_[jColumn]; k < toZero_[jColumn + 1]; k++) {
+          if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
+            if (oneFixesInCliqueEntry(fixEntry_[j])) {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to one implies %d to one and %d to one implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn == jColumn
               } else {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to zero and %d to zero implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn+jColumn=1
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to zero and %d to zero implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn is 0
-                }
+                if (printit)
+                  printf("%d to one implies %d to one and %d to one implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // iColumn is 0
               }
-            }
-          }
-          for (k = toOne_[jColumn]; k < toZero_[jColumn + 1]; k++) {
-            if (sequenceInCliqueEntry(fixEntry_[k]) == (iColumn)) {
-              if (oneFixesInCliqueEntry(fixEntry_[j])) {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to one and %d to one implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn == jColumn
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to one and %d to one implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // iColumn is 0
-                }
+            } else {
+              if (oneFixesInCliqueEntry(fixEntry_[k])) {
+                if (printit)
+                  printf("%d to one implies %d to zero and %d to one implies %d to one\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                nFix++; // jColumn is 0
               } else {
-                if (oneFixesInCliqueEntry(fixEntry_[k])) {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to zero and %d to one implies %d to one\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  nFix++; // jColumn is 0
-                } else {
-                  if (printit && !iPass)
-                    printf("%d to one implies %d to zero and %d to one implies %d to zero\n",
-                      iColumn, jColumn, jColumn, iColumn);
-                  // 1-1 illegal
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, true);
-                    setSequenceInCliqueEntry(temp, iColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    CliqueEntry temp;
-                    setOneFixesInCliqueEntry(temp, true);
-                    setSequenceInCliqueEntry(temp, jColumn);
-                    entry[numberEntries] = temp;
-                  }
-                  numberEntries++;
-                  if (iPass) {
-                    // slack
-                    cliqueType[numberCliques] = 'S';
-                    cliqueStart[numberCliques + 1] = numberEntries;
-                  }
-                  numberCliques++;
-                }
+                if (printit)
+                  printf("%d to one implies %d to zero and %d to one implies %d to zero\n",
+                    iColumn, jColumn, jColumn, iColumn);
+                // 1-1 illegal
+                addPairClique(iColumn, true, jColumn, true, numberCliques, maximumCliques,
+                  numberEntries, maximumEntries, cliqueStart, entry, cliqueType);
               }
             }
           }
         }
       }
     }
-    if (!iPass)
-      printf("%d cliques and %d fixed (%d already from matrix))\n",
-        numberCliques - numberMatrixCliques, nFix, numberMatrixCliques);
   }
+  if (printit)
+    printf("%d cliques and %d fixed (%d already from matrix))\n",
+      numberCliques - numberMatrixCliques, nFix, numberMatrixCliques);
+  whichClique = new int[numberEntries];
   int iClique;
   outDupsEtc(numberIntegers_, numberCliques, numberMatrixCliques,
     cliqueStart, cliqueType, entry, -1, printit ? 2 : 1);
-  printf("%d matrix cliques and %d found by probing\n", numberMatrixCliques, numberCliques - numberMatrixCliques);
   int *zeroStart = new int[numberIntegers_ + 1];
   int *oneStart = new int[numberIntegers_];
   int *zeroCount = new int[numberIntegers_];
@@ -961,9 +1097,10 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
       }
     }
     nStrengthen = 0;
-    CoinBigIndex numberEntries = cliqueStart[numberCliques];
-    CoinBigIndex maximumEntries = numberEntries;
-    int maximumCliques = numberCliques;
+    // whichClique may be smaller than entry so grow both from here
+    numberEntries = cliqueStart[numberCliques];
+    maximumEntries = numberEntries;
+    maximumCliques = numberCliques;
     for (iColumn = 0; iColumn < numberIntegers_; iColumn++) {
       int i;
       int n;
@@ -1006,33 +1143,15 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
         int jCount = count[jClique];
         count[jClique] = 0;
         if (jCount == cliqueStart[jClique + 1] - cliqueStart[jClique]) {
-          printf("Zero can extend %d [ ", jClique);
-          for (CoinBigIndex i = cliqueStart[jClique]; i < cliqueStart[jClique + 1]; i++)
-            printf("%d(%d) ", sequenceInCliqueEntry(entry[i]), oneFixesInCliqueEntry(entry[i]));
-          printf("] by %d(0)\n", iColumn);
-          nStrengthen++;
-          if (numberEntries + jCount + 1 > maximumEntries) {
-            maximumEntries = CoinMax(numberEntries + jCount + 1, (maximumEntries * 12) / 10 + 100);
-            CliqueEntry *temp = new CliqueEntry[maximumEntries];
-            memcpy(temp, entry, numberEntries * sizeof(CliqueEntry));
-            delete[] entry;
-            entry = temp;
-            int *tempI = new int[maximumEntries];
-            memcpy(tempI, whichClique, numberEntries * sizeof(int));
-            delete[] whichClique;
-            whichClique = tempI;
-          }
-          if (numberCliques == maximumCliques) {
-            maximumCliques = (maximumCliques * 12) / 10 + 100;
-            CoinBigIndex *temp = new CoinBigIndex[maximumCliques + 1];
-            memcpy(temp, cliqueStart, (numberCliques + 1) * sizeof(CoinBigIndex));
-            delete[] cliqueStart;
-            cliqueStart = temp;
-            char *tempT = new char[maximumCliques];
-            memcpy(tempT, cliqueType, numberCliques);
-            delete[] cliqueType;
-            cliqueType = tempT;
+          if (printit) {
+            printf("Zero can extend %d [ ", jClique);
+            for (CoinBigIndex i = cliqueStart[jClique]; i < cliqueStart[jClique + 1]; i++)
+              printf("%d(%d) ", sequenceInCliqueEntry(entry[i]), oneFixesInCliqueEntry(entry[i]));
+            printf("] by %d(0)\n", iColumn);
           }
+          nStrengthen++;
+          roomForClique(numberCliques, maximumCliques, numberEntries,
+            maximumEntries, jCount + 1, cliqueStart, entry, cliqueType, whichClique);
           CliqueEntry eI;
           eI.fixes = 0;
           setSequenceInCliqueEntry(eI, iColumn);
@@ -1100,28 +1219,8 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
           }
 #endif
           nStrengthen++;
-          if (numberEntries + jCount + 1 > maximumEntries) {
-            maximumEntries = CoinMax(numberEntries + jCount + 1, (maximumEntries * 12) / 10 + 100);
-            CliqueEntry *temp = new CliqueEntry[maximumEntries];
-            memcpy(temp, entry, numberEntries * sizeof(CliqueEntry));
-            delete[] entry;
-            entry = temp;
-            int *tempI = new int[maximumEntries];
-            memcpy(tempI, whichClique, numberEntries * sizeof(int));
-            delete[] whichClique;
-            whichClique = tempI;
-          }
-          if (numberCliques == maximumCliques) {
-            maximumCliques = (maximumCliques * 12) / 10 + 100;
-            CoinBigIndex *temp = new CoinBigIndex[maximumCliques + 1];
-            memcpy(temp, cliqueStart, (numberCliques + 1) * sizeof(CoinBigIndex));
-            delete[] cliqueStart;
-            cliqueStart = temp;
-            char *tempT = new char[maximumCliques];
-            memcpy(tempT, cliqueType, numberCliques);
-            delete[] cliqueType;
-            cliqueType = tempT;
-          }
+          roomForClique(numberCliques, maximumCliques, numberEntries,
+            maximumEntries, jCount + 1, cliqueStart, entry, cliqueType, whichClique);
           CliqueEntry eI;
           eI.fixes = 0;
           setSequenceInCliqueEntry(eI, iColumn);
@@ -1151,86 +1250,24 @@ CglTreeProbingInfo::analyze(const OsiSolverInterface &si, int createSolver,
     delete[] count;
     delete[] whichCount;
   }
-#if 0
-  if (numberCliques>numberMatrixCliques) {
-    // should keep as cliques and also use in branching ??
-    double * element = new double [numberIntegers_];
-    for (iClique=numberMatrixCliques;iClique<numberCliques;iClique++) {
-      int n=0;
-      double rhs=1.0;
-      for (int i=cliqueStart[iClique];i<cliqueStart[iClique+1];i++) {
-	CliqueEntry eI=entry[i];
-	int iColumn = integerVariable_[sequenceInCliqueEntry(eI)];
-	whichP[n]=iColumn;
-	if (oneFixesInCliqueEntry(eI)) {
-	  element[n++]=1.0;
-	} else {
-	  element[n++]=-1.0;
-	  rhs -= 1.0;
-	}
-      }
-      stored->addCut(-COIN_DBL_MAX,rhs,n,whichP,element);
-    } 
-    delete [] element;
-  }
-#endif
-  OsiSolverInterface *newSolver = NULL;
-  if (numberCliques > numberMatrixCliques || alwaysDo) {
-    newSolver = si.clone();
-    // Delete all rows
-    CoinBigIndex *start = new CoinBigIndex[CoinMax(numberRows, numberCliques + 1)];
-    int i;
-    int *start2 = reinterpret_cast< int * >(start);
-    for (i = 0; i < numberRows; i++)
-      start2[i] = i;
-    newSolver->deleteRows(numberRows, start2);
-    start[0] = 0;
-    CoinBigIndex numberElements = cliqueStart[numberCliques];
-    int *column = new int[numberElements];
-    double *element = new double[numberElements];
-    double *lower = new double[numberCliques];
-    double *upper = new double[numberCliques];
-    numberElements = 0;
-    for (iClique = 0; iClique < numberCliques; iClique++) {
-      double rhs = 1.0;
-      for (CoinBigIndex i = cliqueStart[iClique]; i < cliqueStart[iClique + 1]; i++) {
-        CliqueEntry eI = entry[i];
-        int iColumn = integerVariable_[sequenceInCliqueEntry(eI)];
-        column[numberElements] = iColumn;
-        if (oneFixesInCliqueEntry(eI)) {
-          element[numberElements++] = 1.0;
-        } else {
-          element[numberElements++] = -1.0;
-          rhs -= 1.0;
-        }
-      }
-      start[iClique + 1] = numberElements;
-      assert(cliqueType[iClique] == 'S' || cliqueType[iClique] == 'E');
-      if (cliqueType[iClique] == 'S')
-        lower[iClique] = -COIN_DBL_MAX;
-      else
-        lower[iClique] = rhs;
-      upper[iClique] = rhs;
-    }
-    newSolver->addRows(numberCliques, start, column, element, lower, upper);
-    delete[] start;
-    delete[] column;
-    delete[] element;
-    delete[] lower;
-    delete[] upper;
-  }
   delete[] mark;
   delete[] whichP;
   delete[] whichM;
-  delete[] cliqueStart;
-  delete[] entry;
-  delete[] cliqueType;
   delete[] zeroStart;
   delete[] oneStart;
   delete[] zeroCount;
   delete[] oneCount;
   delete[] whichClique;
-  return newSolver;
+  // keep as stored cliques
+  cliqueStart_ = cliqueStart;
+  cliqueEntry_ = entry;
+  cliqueType_ = cliqueType;
+  numberCliques_ = numberCliques;
+  if (numberCliques_)
+    createCliquesByVariable();
+  else
+    deleteCliques();
+  return numberCliques - numberMatrixCliques;
 }
 // Take action if cut generator can fix a variable (toValue -1 for down, +1 for up)
 bool CglTreeProbingInfo::fixes(int variable, int toValue, int fixedVariable, bool fixedToLower)
@@ -1283,6 +1320,7 @@ int CglTreeProbingInfo::initializeFixing(const OsiSolverInterface *model)
   delete[] integerVariable_;
   delete[] backward_;
   delete[] fixingEntry_;
+  deleteCliques();
   numberVariables_ = model->getNumCols();
   // Too many ... but
   integerVariable_ = new int[numberVariables_];
@@ -1385,70 +1423,18 @@ int CglTreeProbingInfo::fixColumns(OsiSolverInterface &si) const
   bool feasible = true;
   for (int jColumn = 0; jColumn < static_cast< int >(numberIntegers_); jColumn++) {
     int iColumn = integerVariable_[jColumn];
-    if (upper[iColumn] == 0.0) {
-      int j;
-      for (j = toZero_[jColumn]; j < toOne_[jColumn]; j++) {
-        int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
-        kColumn = integerVariable_[kColumn];
-        bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
-        if (fixToOne) {
-          if (lower[kColumn] == 0.0) {
-            if (upper[kColumn] == 1.0) {
-              si.setColLower(kColumn, 1.0);
-              nFix++;
-            } else {
-              // infeasible!
-              feasible = false;
-            }
-          }
-        } else {
-          if (upper[kColumn] == 1.0) {
-            if (lower[kColumn] == 0.0) {
-              si.setColUpper(kColumn, 0.0);
-              nFix++;
-            } else {
-              // infeasible!
-              feasible = false;
-            }
-          }
-        }
-      }
-    } else if (lower[iColumn] == 1.0) {
-      int j;
-      for (j = toOne_[jColumn]; j < toZero_[jColumn + 1]; j++) {
-        int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
-        kColumn = integerVariable_[kColumn];
-        bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
-        if (fixToOne) {
-          if (lower[kColumn] == 0.0) {
-            if (upper[kColumn] == 1.0) {
-              si.setColLower(kColumn, 1.0);
-              nFix++;
-            } else {
-              // infeasible!
-              feasible = false;
-            }
-          }
-        } else {
-          if (upper[kColumn] == 1.0) {
-            if (lower[kColumn] == 0.0) {
-              si.setColUpper(kColumn, 0.0);
-              nFix++;
-            } else {
-              // infeasible!
-              feasible = false;
-            }
-          }
-        }
-      }
-    }
+    int n = 0;
+    if (upper[iColumn] == 0.0)
+      n = fixColumns(iColumn, 0, si);
+    else if (lower[iColumn] == 1.0)
+      n = fixColumns(iColumn, 1, si);
+    if (n >= 0)
+      nFix += n;
+    else
+      feasible = false;
   }
-  if (!feasible) {
-#ifdef COIN_DEVELOP
-    printf("treeprobing says infeasible!\n");
-#endif
+  if (!feasible)
     nFix = -1;
-  }
   return nFix;
 }
 // Fix entries in a solver using implications for one variable
@@ -1459,62 +1445,32 @@ int CglTreeProbingInfo::fixColumns(int iColumn, int value, OsiSolverInterface &s
   const double *lower = si.getColLower();
   const double *upper = si.getColUpper();
   bool feasible = true;
-  int jColumn = backward_[iColumn];
-  if (jColumn < 0 || !toZero_)
-    return 0;
-  if (!value) {
-    int j;
-    for (j = toZero_[jColumn]; j < toOne_[jColumn]; j++) {
-      int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
-      kColumn = integerVariable_[kColumn];
-      bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
-      if (fixToOne) {
-        if (lower[kColumn] == 0.0) {
-          if (upper[kColumn] == 1.0) {
-            si.setColLower(kColumn, 1.0);
-            nFix++;
-          } else {
-            // infeasible!
-            feasible = false;
-          }
-        }
-      } else {
+  const CliqueEntry *entries;
+  int n = implications(iColumn, value, entries);
+  for (int j = 0; j < n; j++) {
+    int kColumn = sequenceInCliqueEntry(entries[j]);
+    if (kColumn >= numberIntegers_)
+      continue; // not 0-1
+    kColumn = integerVariable_[kColumn];
+    bool fixToOne = oneFixesInCliqueEntry(entries[j]);
+    if (fixToOne) {
+      if (lower[kColumn] == 0.0) {
         if (upper[kColumn] == 1.0) {
-          if (lower[kColumn] == 0.0) {
-            si.setColUpper(kColumn, 0.0);
-            nFix++;
-          } else {
-            // infeasible!
-            feasible = false;
-          }
+          si.setColLower(kColumn, 1.0);
+          nFix++;
+        } else {
+          // infeasible!
+          feasible = false;
         }
       }
-    }
-  } else {
-    int j;
-    for (j = toOne_[jColumn]; j < toZero_[jColumn + 1]; j++) {
-      int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
-      kColumn = integerVariable_[kColumn];
-      bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
-      if (fixToOne) {
+    } else {
+      if (upper[kColumn] == 1.0) {
         if (lower[kColumn] == 0.0) {
-          if (upper[kColumn] == 1.0) {
-            si.setColLower(kColumn, 1.0);
-            nFix++;
-          } else {
-            // infeasible!
-            feasible = false;
-          }
-        }
-      } else {
-        if (upper[kColumn] == 1.0) {
-          if (lower[kColumn] == 0.0) {
-            si.setColUpper(kColumn, 0.0);
-            nFix++;
-          } else {
-            // infeasible!
-            feasible = false;
-          }
+          si.setColUpper(kColumn, 0.0);
+          nFix++;
+        } else {
+          // infeasible!
+          feasible = false;
         }
       }
     }
@@ -1562,7 +1518,9 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
   CoinPackedVector ubs(false);
   int numberFixed = 0;
   char *fixed = NULL;
-  for (int jColumn = 0; jColumn < static_cast< int >(numberIntegers_); jColumn++) {
+  // implications are only there once in order
+  int numberIntegers = toZero_ ? numberIntegers_ : 0;
+  for (int jColumn = 0; jColumn < numberIntegers; jColumn++) {
     int iColumn = integerVariable_[jColumn];
     assert(iColumn >= 0 && iColumn < si.getNumCols());
     if (lower[iColumn] == 0.0 && upper[iColumn] == 1.0) {
@@ -1570,6 +1528,8 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
       int j;
       for (j = toZero_[jColumn]; j < toOne_[jColumn]; j++) {
         int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
+        if (kColumn >= numberIntegers_)
+          continue; // not 0-1
         kColumn = integerVariable_[kColumn];
         assert(kColumn >= 0 && kColumn < si.getNumCols());
         assert(kColumn != iColumn);
@@ -1609,6 +1569,8 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
       }
       for (j = toOne_[jColumn]; j < toZero_[jColumn + 1]; j++) {
         int kColumn = sequenceInCliqueEntry(fixEntry_[j]);
+        if (kColumn >= numberIntegers_)
+          continue; // not 0-1
         kColumn = integerVariable_[kColumn];
         assert(kColumn >= 0 && kColumn < si.getNumCols());
         assert(kColumn != iColumn);
@@ -1649,6 +1611,8 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
     } else if (upper[iColumn] == 0.0) {
       for (int j = toZero_[jColumn]; j < toOne_[jColumn]; j++) {
         int kColumn01 = sequenceInCliqueEntry(fixEntry_[j]);
+        if (kColumn01 >= numberIntegers_)
+          continue; // not 0-1
         int kColumn = integerVariable_[kColumn01];
         assert(kColumn >= 0 && kColumn < si.getNumCols());
         bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
@@ -1683,6 +1647,8 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
     } else {
       for (int j = toOne_[jColumn]; j < toZero_[jColumn + 1]; j++) {
         int kColumn01 = sequenceInCliqueEntry(fixEntry_[j]);
+        if (kColumn01 >= numberIntegers_)
+          continue; // not 0-1
         int kColumn = integerVariable_[kColumn01];
         assert(kColumn >= 0 && kColumn < si.getNumCols());
         bool fixToOne = oneFixesInCliqueEntry(fixEntry_[j]);
@@ -1746,6 +1712,53 @@ void CglTreeProbingInfo::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
 
   if (fixed)
     delete[] fixed;
+  // Now any stored cliques - a violated one must have a fractional member
+  if (numberCliques_) {
+    int *index = new int[numberIntegers_];
+    double *element = new double[numberIntegers_];
+    char *looked = new char[numberCliques_];
+    memset(looked, 0, numberCliques_);
+    for (int jColumn = 0; jColumn < numberIntegers_; jColumn++) {
+      double value1 = colsol[integerVariable_[jColumn]];
+      if (value1 < 1.0e-6 || value1 > 1.0 - 1.0e-6)
+        continue;
+      for (int k = cliqueByVariableStart_[jColumn]; k < cliqueByVariableStart_[jColumn + 1]; k++) {
+        int iClique = cliqueByVariable_[k];
+        if (looked[iClique])
+          continue;
+        looked[iClique] = 1;
+        CoinBigIndex start = cliqueStart_[iClique];
+        CoinBigIndex end = cliqueStart_[iClique + 1];
+        double sum = 0.0;
+        double rhs = 1.0;
+        int n = 0;
+        for (CoinBigIndex j = start; j < end; j++) {
+          int iColumn = integerVariable_[sequenceInCliqueEntry(cliqueEntry_[j])];
+          double value = colsol[iColumn];
+          index[n] = iColumn;
+          if (oneFixesInCliqueEntry(cliqueEntry_[j])) {
+            sum += value;
+            element[n++] = 1.0;
+          } else {
+            sum += 1.0 - value;
+            rhs -= 1.0;
+            element[n++] = -1.0;
+          }
+        }
+        if (sum > 1.00001) {
+          OsiRowCut rc;
+          rc.setLb(-COIN_DBL_MAX);
+          rc.setUb(rhs);
+          rc.setRow(n, index, element, false);
+          rc.setEffectiveness(sum - 1.0);
+          cs.insertIfNotDuplicate(rc);
+        }
+      }
+    }
+    delete[] index;
+    delete[] element;
+    delete[] looked;
+  }
 }
 
 /* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
@@ -11,6 +11,9 @@
 #include "CglConfig.h"
 
 class CglStored;
+class CglSolutionDigest;
+class CglModelComponents;
+class CglImpliedIntegers;
 /** Information about where the cut generator is invoked from. */
 
 class CGLLIB_EXPORT CglTreeInfo {
@@ -62,6 +65,21 @@ public:
   OsiRowCut **strengthenRow;
   /// Optional pointer to thread specific random number generator
   CoinThreadRandom *randomNumberGenerator;
+  /** Optional summary of current solution shared by cut generators.
+      Owned by caller who must keep it up to date (see CglSolutionDigest::matches).
+      CglClique and CglProbing take fractional columns from it and
+      Gomory, Twomir, GMI, LandP, OddHole and BKClique return at once if
+      it has no fractional integers. */
+  const CglSolutionDigest *solutionDigest;
+  /** Optional independent blocks of model.  Owned by caller and only
+      used by generators if dimensions match solver.  At present only
+      CglClique uses it (CglOddHole and CglZeroHalf do not). */
+  const CglModelComponents *components;
+  /** Optional implied integer information.  Owned by caller and only
+      used by generators if dimensions match solver.  Columns which are
+      only integral in some optimal solution are used only if caller
+      set CglImpliedIntegers::setAllowWeak. */
+  const CglImpliedIntegers *impliedIntegers;
   /// Default constructor
   CglTreeInfo();
 
@@ -112,9 +130,19 @@ public:
 
   /// Destructor
   virtual ~CglTreeProbingInfo();
+  /** Finds cliques (see findCliques) and if createSolver nonzero and
+      probing found any returns a clone of si with rows replaced by cliques.
+      numberExtraCliques -1 means always create solver. */
   OsiSolverInterface *analyze(const OsiSolverInterface &si, int createSolver = 0,
     int numberExtraCliques = 0, const CoinBigIndex *starts = NULL,
     const CliqueEntry *entries = NULL, const char *type = NULL);
+  /** Finds cliques from rows of si, any extra cliques (sequences are 0-1
+      indices) and pairs of implications, strengthens them and keeps them
+      as stored cliques.  Rows are scanned once and cliques are written
+      straight into the store.  Returns number of cliques not from matrix. */
+  int findCliques(const OsiSolverInterface &si,
+    int numberExtraCliques = 0, const CoinBigIndex *starts = NULL,
+    const CliqueEntry *entries = NULL, const char *type = NULL);
   /** Take action if cut generator can fix a variable 
       (toValue -1 for down, +1 for up)
       Returns true if still room, false if not  */
@@ -169,10 +197,74 @@ public:
   {
     return numberIntegers_;
   }
+  /** Implications of column iColumn (in matrix) going to value (0 or 1).
+      Sets entries to first and returns number (0 if not 0-1).
+      Sequences in entries are 0-1 indices, or numberIntegers()+column
+      if not 0-1. Entries must already be in order (see toZero()). */
+  inline int implications(int iColumn, int value, const CliqueEntry *&entries) const
+  {
+    int jColumn = backward_ ? backward_[iColumn] : -1;
+    if (jColumn < 0 || !toZero_) {
+      entries = NULL;
+      return 0;
+    }
+    int start = value ? toOne_[jColumn] : toZero_[jColumn];
+    int end = value ? toZero_[jColumn + 1] : toOne_[jColumn];
+    entries = fixEntry_ + start;
+    return end - start;
+  }
+  /** Stores a clique table (as created by CglProbing) alongside the
+      implications.  Sequences in entries are columns in matrix; cliques
+      are kept on 0-1 variables only.  Must be called after initializeFixing.
+      Used by CglImplication and (see CglClique::setProbingInfo) as extra
+      edges by CglClique.  CglBKClique, CglOddWheel and
+      CglCliqueStrengthening do not read it - they use the conflict graph
+      of the solver (getCGraph).
+  */
+  void setCliques(int numberCliques, const CoinBigIndex *cliqueStart,
+    const CliqueEntry *entries);
+  /// Number of stored cliques
+  inline int numberCliques() const
+  {
+    return numberCliques_;
+  }
+  /// Start of each stored clique
+  inline const CoinBigIndex *cliqueStart() const
+  {
+    return cliqueStart_;
+  }
+  /// Entries for stored cliques (sequence is 0-1 index)
+  inline const CliqueEntry *cliqueEntry() const
+  {
+    return cliqueEntry_;
+  }
+  /// Type of each stored clique - 'S' if slack, 'E' if equality
+  inline const char *cliqueType() const
+  {
+    return cliqueType_;
+  }
+  /** Cliques containing column iColumn (in matrix).
+      Sets which to first and returns number. */
+  inline int cliquesOf(int iColumn, const int *&which) const
+  {
+    int jColumn = backward_ ? backward_[iColumn] : -1;
+    if (jColumn < 0 || !numberCliques_) {
+      which = NULL;
+      return 0;
+    }
+    which = cliqueByVariable_ + cliqueByVariableStart_[jColumn];
+    return cliqueByVariableStart_[jColumn + 1] - cliqueByVariableStart_[jColumn];
+  }
 
 private:
   /// Converts to ordered
   void convert();
+  /// Frees stored cliques
+  void deleteCliques();
+  /// Copies stored cliques
+  void copyCliques(const CglTreeProbingInfo &rhs);
+  /// Creates cliques for each variable from stored cliques
+  void createCliquesByVariable();
 
 protected:
   /// Entries for fixing variables
@@ -195,6 +287,18 @@ protected:
   int maximumEntries_;
   /// Number entries in fixingEntry_ (and fixEntry_) or -2 if correct style
   int numberEntries_;
+  /// Start of each stored clique
+  CoinBigIndex *cliqueStart_;
+  /// Entries for stored cliques (sequence is 0-1 index)
+  CliqueEntry *cliqueEntry_;
+  /// Type of each stored clique
+  char *cliqueType_;
+  /// Start of cliques for each 0-1 variable
+  int *cliqueByVariableStart_;
+  /// Cliques for each 0-1 variable
+  int *cliqueByVariable_;
+  /// Number of stored cliques
+  int numberCliques_;
 };
 inline int sequenceInCliqueEntry(const CliqueEntry &cEntry)
 {
@@ -148,21 +148,16 @@ void CglDuplicateRow::generateCuts12(const OsiSolverInterface & si, OsiCuts & cs
     // First look at duplicate or dominated columns
     double * random = new double[numberRows];
     double * sort = new double[numberColumns+1];
-    if (info.randomNumberGenerator) {
-      const CoinThreadRandom * randomGenerator = info.randomNumberGenerator;
-      for (i=0;i<numberRows;i++) {
-	if (rowLower[i]<-1.0e20||rowUpper[i]>1.0e20)
-	  random[i]=0.0;
-	else
-	  random[i] = randomGenerator->randomDouble();
-      }
-    } else {
-      for (i=0;i<numberRows;i++) {
-	if (rowLower[i]<-1.0e20||rowUpper[i]>1.0e20)
-	  random[i]=0.0;
-	else
-	  random[i] = CoinDrand48();
-      }
+    // if no generator passed in use a local one - so thread safe and
+    // same numbers on every call
+    CoinThreadRandom localGenerator(987654321);
+    const CoinThreadRandom * randomGenerator = info.randomNumberGenerator ?
+      info.randomNumberGenerator : &localGenerator;
+    for (i=0;i<numberRows;i++) {
+      if (rowLower[i]<-1.0e20||rowUpper[i]>1.0e20)
+	random[i]=0.0;
+      else
+	random[i] = randomGenerator->randomDouble();
     }
     int * which = new int[numberColumns];
     int nPossible=0;
@@ -15,6 +15,7 @@
 #include <cassert>
 #include <iostream>
 #include <climits>
+#include <algorithm>
 
 #include "CoinPragma.hpp"
 #include "CoinHelperFunctions.hpp"
@@ -25,6 +26,8 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CoinFactorization.hpp"
 #include "CglGMI.hpp"
+#include "CglImpliedIntegers.hpp"
+#include "CglSolutionDigest.hpp"
 #include "CoinFinite.hpp"
 #include "CoinRational.hpp"
 
@@ -47,6 +50,7 @@ CglGMI::CglGMI() :
   cstat(NULL),
   rstat(NULL),
   solver(NULL),
+  impliedIntegers(NULL),
   xlp(NULL),
   rowActivity(NULL),
   byRow(NULL),
@@ -83,6 +87,7 @@ CglGMI::CglGMI(const CglGMIParam &parameters) :
   cstat(NULL),
   rstat(NULL),
   solver(NULL),
+  impliedIntegers(NULL),
   xlp(NULL),
   rowActivity(NULL),
   byRow(NULL),
@@ -119,6 +124,7 @@ CglGMI::CglGMI(const CglGMI& rhs) :
   cstat(rhs.cstat),
   rstat(rhs.rstat),
   solver(rhs.solver),
+  impliedIntegers(rhs.impliedIntegers),
   xlp(rhs.xlp),
   rowActivity(rhs.rowActivity),
   byRow(rhs.byRow),
@@ -156,6 +162,7 @@ CglGMI & CglGMI::operator=(const CglGMI& rhs) {
     cstat = rhs.cstat;
     rstat = rhs.rstat;
     solver = rhs.solver;
+    impliedIntegers = rhs.impliedIntegers;
     xlp = rhs.xlp;
     rowActivity = rhs.rowActivity;
     byRow = rhs.byRow;
@@ -288,7 +295,7 @@ inline double CglGMI::computeCutCoefficient(double rowElem, int index) {
 } /* computeCutCoefficient */
 
 /************************************************************************/
-inline void CglGMI::eliminateSlack(double cutElem, int index, double* cut,
+inline bool CglGMI::eliminateSlack(double cutElem, int index, double* cut,
 				   double& cutRhs, const double *elements, 
 				   const CoinBigIndex *rowStart, const int *indices, 
 				   const int *rowLength, const double *rhs) {
@@ -300,7 +307,7 @@ inline void CglGMI::eliminateSlack(double cutElem, int index, double* cut,
     if (areEqual(rowLower[rowpos], rowUpper[rowpos], 
 		 param.getEPS(), param.getEPS())) {
       // "almost" fixed slack, we'll just skip it
-      return;
+      return false;
     }
 
     CoinBigIndex upto = rowStart[rowpos] + rowLength[rowpos];
@@ -308,7 +315,9 @@ inline void CglGMI::eliminateSlack(double cutElem, int index, double* cut,
       cut[indices[j]] -= cutElem * elements[j];      
     }
     cutRhs -= cutElem * rhs[rowpos];
+    return true;
   }
+  return false;
 
 } /* eliminateSlack */
 
@@ -361,6 +370,21 @@ inline void CglGMI::packRow(double* row, double* rowElem, int* rowIndex,
   }
 }
 
+/************************************************************************/
+inline void CglGMI::packRow(double* row, int* which, int numWhich,
+			    double* rowElem, int* rowIndex, int& rowNz) {
+  std::sort(which, which + numWhich);
+  rowNz = 0;
+  for (int k = 0; k < numWhich; ++k) {
+    int i = which[k];
+    if (!isZero(fabs(row[i]))) {
+      rowElem[rowNz] = row[i];
+      rowIndex[rowNz] = i;
+      rowNz++;
+    }
+  }
+}
+
 /************************************************************************/
 bool CglGMI::cleanCut(double* cutElem, int* cutIndex, int& cutNz,
 		       double& cutRhs, const double* xbar) {
@@ -964,7 +988,7 @@ long CglGMI::computeGcd(long a, long b) {
 
 /************************************************************************/
 void CglGMI::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
-			  const CglTreeInfo )
+			  const CglTreeInfo info)
 {
   solver = const_cast<OsiSolverInterface *>(&si);
   if (solver == NULL) {
@@ -999,6 +1023,16 @@ void CglGMI::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
   byCol = solver->getMatrixByCol();
+  // continuous columns known to be integer (if for this model)
+  impliedIntegers = info.impliedIntegers;
+  if (impliedIntegers && (impliedIntegers->numberColumns() != ncol ||
+			  impliedIntegers->numberRows() != nrow))
+    impliedIntegers = NULL;
+  // Nothing to do if shared digest has no integer far enough from integer
+  // (implied integers are not in digest)
+  if (!impliedIntegers &&
+      CglSolutionDigest::noneFractional(si, info, param.getAway()))
+    return;
   
   generateCuts(cs);
 
@@ -1098,8 +1132,14 @@ void CglGMI::generateCuts(OsiCuts &cs)
   int cutNz = 0;
   double cutRhs;
 
-  // cut in dense form
+  // cut in dense form, with the list of its possible nonzeros so that
+  // resetting and packing need not look at all columns
   double* cut = new double[ncol];
+  CoinZeroN(cut, ncol);
+  int* cutTouched = new int[ncol];
+  char* inCut = new char[ncol];
+  CoinZeroN(inCut, ncol);
+  int numCutTouched = 0;
 
   double *slackVal = new double[nrow];
 
@@ -1107,6 +1147,17 @@ void CglGMI::generateCuts(OsiCuts &cs)
     slackVal[i] = rowRhs[i] - rowActivity[i];
   }
 
+  // Nonbasic columns which are not fixed - the same for every tableau row
+  int* nonBasicColumn = new int[ncol];
+  int numNonBasic = 0;
+  for (int j = 0; j < ncol; ++j) {
+    if ((colBasisIndex[j] < 0) && 
+	(!areEqual(colLower[j], colUpper[j], 
+		   param.getEPS(), param.getEPS()))) {
+      nonBasicColumn[numNonBasic++] = j;
+    }
+  }
+
 #if defined OSI_TABLEAU
   // Column part and row part of a row of the simplex tableau
   double* tableauColPart = new double[ncol];
@@ -1130,6 +1181,20 @@ void CglGMI::generateCuts(OsiCuts &cs)
   double * arrayElements = array.denseVector();
   // End of code to create work arrays
   double one = 1.0;
+
+  // When the row of the basis inverse is sparse the column part of the
+  // tableau row is obtained by going through the matrix by rows, touching
+  // only the columns which can be nonzero; otherwise the dense dot
+  // products over nonbasic columns are cheaper
+  CoinBigIndex numNonBasicElements = 0;
+  for (int k = 0; k < numNonBasic; ++k) {
+    numNonBasicElements += columnLength[nonBasicColumn[k]];
+  }
+  double* tableauRow = new double[ncol];
+  CoinZeroN(tableauRow, ncol);
+  int* tableauIndex = new int[ncol];
+  char* inTableau = new char[ncol];
+  CoinZeroN(inTableau, ncol);
 #endif
 
   // Matrix elements by row for slack substitution
@@ -1177,23 +1242,65 @@ void CglGMI::generateCuts(OsiCuts &cs)
 #endif
 
     // reset the cut
-    memset(cut, 0, ncol*sizeof(double));
-
-    // columns
-    for (int j = 0; j < ncol; ++j) {
-      if ((colBasisIndex[j] >= 0) || 
-	  (areEqual(colLower[j], colUpper[j], 
-		    param.getEPS(), param.getEPS()))) {
-	// Basic or fixed variable -- skip
-	continue;
+    for (int k = 0; k < numCutTouched; ++k) {
+      int j = cutTouched[k];
+      cut[j] = 0.0;
+      inCut[j] = 0;
+    }
+    numCutTouched = 0;
+
+#ifdef OSI_TABLEAU
+    const int numCandidates = numNonBasic;
+    const int* candidate = nonBasicColumn;
+#else
+    CoinBigIndex rowWork = 0;
+    for (int k = 0; k < numberInArray; ++k) {
+      rowWork += rowLength[arrayRows[k]];
+    }
+    bool sparseRow = (2*rowWork < numNonBasicElements);
+    int numCandidates = numNonBasic;
+    const int* candidate = nonBasicColumn;
+    if (sparseRow) {
+      // row of tableau as sum of rows of the matrix
+      numCandidates = 0;
+      for (int k = 0; k < numberInArray; ++k) {
+	int iRow = arrayRows[k];
+	double value = arrayElements[iRow];
+	CoinBigIndex upto = rowStart[iRow] + rowLength[iRow];
+	for (CoinBigIndex h = rowStart[iRow]; h < upto; ++h) {
+	  int j = indices[h];
+	  if (!inTableau[j]) {
+	    inTableau[j] = 1;
+	    tableauIndex[numCandidates++] = j;
+	  }
+	  tableauRow[j] += value*elements[h];
+	}
       }
+      candidate = tableauIndex;
+    }
+#endif
+
+    // columns (basic or fixed variables skipped)
+    for (int k = 0; k < numCandidates; ++k) {
+      int j = candidate[k];
 #ifdef OSI_TABLEAU
       rowElem = tableauColPart[j];
 #else
-      rowElem = 0.0;
-      // add in row of tableau
-      for (CoinBigIndex h = columnStart[j]; h < columnStart[j]+columnLength[j]; ++h) {
-	rowElem += columnElements[h]*arrayElements[row[h]];
+      if (sparseRow) {
+	rowElem = tableauRow[j];
+	tableauRow[j] = 0.0;
+	inTableau[j] = 0;
+	if (colBasisIndex[j] >= 0 ||
+	    areEqual(colLower[j], colUpper[j], 
+		     param.getEPS(), param.getEPS())) {
+	  continue;
+	}
+      } else {
+	rowElem = 0.0;
+	// add in row of tableau
+	for (CoinBigIndex h = columnStart[j]; h < columnStart[j]+columnLength[j]; ++h) {
+	  rowElem += columnElements[h]*arrayElements[row[h]];
+	}
       }
 #endif
       if (!isZero(fabs(rowElem))) {
@@ -1205,6 +1312,8 @@ void CglGMI::generateCuts(OsiCuts &cs)
 	}
 	unflipOrig(cutCoeff, j, cutRhs);
 	cut[j] = cutCoeff;
+	inCut[j] = 1;
+	cutTouched[numCutTouched++] = j;
 #if defined GMI_TRACE
 	printf("var %d, row %f, cut %f\n", j, rowElem, cutCoeff);
 #endif
@@ -1236,15 +1345,29 @@ void CglGMI::generateCuts(OsiCuts &cs)
 	  continue;
 	}
 	unflipSlack(cutCoeff, slackIndex, cutRhs, slackVal);
-	eliminateSlack(cutCoeff, slackIndex, cut, cutRhs,
-		       elements, rowStart, indices, rowLength, rowRhs);
+	if (eliminateSlack(cutCoeff, slackIndex, cut, cutRhs,
+			   elements, rowStart, indices, rowLength, rowRhs)) {
+	  int rowpos = slackIndex - ncol;
+	  CoinBigIndex upto = rowStart[rowpos] + rowLength[rowpos];
+	  for (CoinBigIndex h = rowStart[rowpos]; h < upto; ++h) {
+	    int jCol = indices[h];
+	    if (!inCut[jCol]) {
+	      inCut[jCol] = 1;
+	      cutTouched[numCutTouched++] = jCol;
+	    }
+	  }
+	}
 #if defined GMI_TRACE
 	printf("var %d, row %f, cut %f\n", slackIndex, rowElem, cutCoeff);
 #endif
       }
     }
 
-    packRow(cut, cutElem, cutIndex, cutNz);
+    if (4*numCutTouched < ncol) {
+      packRow(cut, cutTouched, numCutTouched, cutElem, cutIndex, cutNz);
+    } else {
+      packRow(cut, cutElem, cutIndex, cutNz);
+    }
     if (cutNz == 0)
       continue;
 
@@ -1282,11 +1405,18 @@ void CglGMI::generateCuts(OsiCuts &cs)
   delete[] basicVars;
   delete[] tableauColPart;
   delete[] tableauRowPart;
+#else
+  delete[] tableauRow;
+  delete[] tableauIndex;
+  delete[] inTableau;
 #endif
 
   delete[] colBasisIndex;
   delete[] rowBasisIndex;
+  delete[] nonBasicColumn;
   delete[] cut;
+  delete[] cutTouched;
+  delete[] inCut;
   delete[] slackVal;
   delete[] cutElem;
   delete[] cutIndex;
@@ -1315,6 +1445,11 @@ void CglGMI::computeIsInteger() {
 	// continuous variable fixed to an integer value
 	isInteger[i] = true;
       }
+      else if (impliedIntegers &&
+	       impliedIntegers->isInteger(i, colLower[i], colUpper[i])) {
+	// continuous variable implied to be integer
+	isInteger[i] = true;
+      }
       else {
 	isInteger[i] = false;
       }
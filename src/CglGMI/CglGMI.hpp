@@ -183,8 +183,8 @@ private:
   inline double computeCutCoefficient(double rowElem, int index);
 
   /// Use multiples of the initial inequalities to cancel out the coefficient
-  /// on a slack variables. 
-  inline void eliminateSlack(double cutElem, int cutIndex, double* cut,
+  /// on a slack variables. Returns true if the cut was modified.
+  inline bool eliminateSlack(double cutElem, int cutIndex, double* cut,
 			      double& cutRhs, const double *elements, 
 			      const CoinBigIndex *rowStart, const int *indices, 
 			      const int *rowLength, const double *rhs);
@@ -205,6 +205,11 @@ private:
   inline void packRow(double* row, double* rowElem, int* rowIndex,
 		       int& rowNz);
 
+  /// Pack the numWhich entries of a row listed in which (which is
+  /// sorted on exit)
+  inline void packRow(double* row, int* which, int numWhich,
+		      double* rowElem, int* rowIndex, int& rowNz);
+
   /// Clean the cutting plane; the cleaning procedure does several things
   /// like removing small coefficients, scaling, and checks several
   /// acceptance criteria. If this returns false, the cut should be discarded.
@@ -315,6 +320,9 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Optional implied integer information. Reset by each call to generateCuts().
+  const CglImpliedIntegers *impliedIntegers;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
@@ -44,6 +44,7 @@
 #endif
 #include "CoinWarmStartBasis.hpp"
 #include "CglGomory.hpp"
+#include "CglSolutionDigest.hpp"
 #include "CoinFinite.hpp"
 #ifdef CGL_DEBUG_GOMORY
 int gomory_try=CGL_DEBUG_GOMORY;
@@ -57,6 +58,11 @@ void CglGomory::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 #ifdef CGL_DEBUG_GOMORY
   gomory_try++;
 #endif
+  // Nothing to do if shared digest has no integer far enough from integer
+  if (!gomoryType_ &&
+      CglSolutionDigest::noneFractional(si, info, info.inTree ? away_ :
+					CoinMin(away_, awayAtRoot_)))
+    return;
   // Get basic problem information
   int numberColumns=si.getNumCols(); 
   
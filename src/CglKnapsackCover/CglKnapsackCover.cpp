@@ -52,6 +52,36 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   int * restInd = reinterpret_cast<int *> (elements_+size1);
   CoinFillN(restInd,nCols,-2);
 #endif
+#ifdef GUBCOVER
+  // gub information is set up for each row when first needed and kept
+  // between calls (setupGubRow checks row has not changed)
+  if (gubRow_>=0) {
+    const int * block = gubRowCache_[gubRow_];
+    for (int k=0;k<block[0];k++)
+      gubStart_[block[1+k]]=-1;
+  }
+  if (nCols!=numberGubColumns_)
+    deleteGubRows();
+  if (!gubStart_) {
+    numberGubColumns_=nCols;
+    gubStart_=new int [nCols];
+    CoinFillN(gubStart_,nCols,-1);
+  }
+  if (nRows!=numberGubRows_) {
+    int ** temp = new int * [nRows];
+    int n = CoinMin(nRows,numberGubRows_);
+    CoinMemcpyN(gubRowCache_,n,temp);
+    for (int i=n;i<numberGubRows_;i++)
+      delete [] gubRowCache_[i];
+    for (int i=n;i<nRows;i++)
+      temp[i]=NULL;
+    delete [] gubRowCache_;
+    gubRowCache_=temp;
+    numberGubRows_=nRows;
+  }
+  gubRow_=-1;
+  gubEntry_=NULL;
+#endif
     
   // Create a local copy of the column solution (colsol), call it xstar, and
   // inititalize it. 
@@ -785,6 +815,14 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   delete[] complement;
 #ifdef GUBCOVER
   delete [] elements_;
+  // take last row out of gubStart_
+  if (gubRow_>=0) {
+    const int * block = gubRowCache_[gubRow_];
+    for (int k=0;k<block[0];k++)
+      gubStart_[block[1+k]]=-1;
+  }
+  gubRow_=-1;
+  gubEntry_=NULL;
 #endif
   delete [] thisColumnIndex;
   delete [] thisElement;
@@ -798,6 +836,44 @@ void CglKnapsackCover::generateCuts(const OsiSolverInterface& si, OsiCuts& cs,
   delete [] effectiveUpper;
 }
 
+//-------------------------------------------------------------------
+// Generate knapsack cover cuts for several points
+//------------------------------------------------------------------- 
+void CglKnapsackCover::generateCutsMulti(const OsiSolverInterface& si,
+					 int numberPoints,
+					 const double * const * solutions,
+					 const double * const * lowers,
+					 const double * const * uppers,
+					 OsiCuts* cs,
+					 const CglTreeInfo info)
+{
+  // Only solution, bounds and matrix are used so a copy with solution
+  // and bounds of point is enough.  Rows of copy do not change so gub
+  // information kept for each row is found once for all points.
+  OsiSolverInterface * copy = NULL;
+  const int nCols = si.getNumCols();
+  for (int k = 0; k < numberPoints; k++) {
+    const double * lower = (lowers && lowers[k]) ? lowers[k] : si.getColLower();
+    const double * upper = (uppers && uppers[k]) ? uppers[k] : si.getColUpper();
+    if (!copy && solutions[k] == si.getColSolution()
+	&& lower == si.getColLower() && upper == si.getColUpper()) {
+      generateCuts(si, cs[k], info);
+      continue;
+    }
+    if (!copy)
+      copy = si.clone();
+    const double * copyLower = copy->getColLower();
+    const double * copyUpper = copy->getColUpper();
+    for (int j = 0; j < nCols; j++) {
+      if (lower[j] != copyLower[j] || upper[j] != copyUpper[j])
+	copy->setColBounds(j, lower[j], upper[j]);
+    }
+    copy->setColSolution(solutions[k]);
+    generateCuts(*copy, cs[k], info);
+  }
+  delete copy;
+}
+
 void
 CglKnapsackCover::setTestedRowIndices(int num, const int* ind)
 {
@@ -3300,7 +3376,7 @@ CglKnapsackCover::liftCoverCut(
   delete [] mu;
 
 #ifdef GUBCOVER
-  if (goodCut&&numberCliques_) {
+  if (goodCut&&numberCliques_&&gubStart_) {
     int n = cut.getNumElements();
     const int * ind3;
     const double * els3;
@@ -3314,6 +3390,8 @@ CglKnapsackCover::liftCoverCut(
     int numberColumns = solver_->getNumCols();
     double * els = elements_;
     double * els2 = els+numberColumns;
+    if (gubRow_!=whichRow_)
+      setupGubRow();
     for (i=0;i<n;i++) 
       els[ind3[i]]=els3[i];
     for (CoinBigIndex i=rowStart[whichRow_];i<rowStart[whichRow_]+rowLength[whichRow_];i++) {
@@ -3327,52 +3405,41 @@ CglKnapsackCover::liftCoverCut(
       int iColumn = ind3[i];
       // complement doesn't seem to work?
       if (!complement_[iColumn]) {
-	if (oneFixStart_[iColumn]>=0) {
+	if (gubStart_[iColumn]>=0) {
 	  /* I (JJF) don't think this is valid for more than one clique
 	     Best would be to choose largest set of additions - but that means code
 	     and I don't really understand existing code
 	   */
 	  bool skipClique=false;
-	  for (int j=oneFixStart_[iColumn];j<zeroFixStart_[iColumn];j++) {
-	    if (skipClique)
-	      break;
-	    int iClique = whichClique_[j];
-	    for (int k=cliqueStart_[iClique];k<cliqueStart_[iClique+1];k++) {
-	      int jColumn = sequenceInCliqueEntry(cliqueEntry_[k]);
-	      if (!els[jColumn]&&els2[jColumn]) {
-		assert (jColumn!=iColumn);
-		if (!complement_[jColumn]&&oneFixesInCliqueEntry(cliqueEntry_[k])) {
-		  //if (els2[iColumn]<0.0||els2[jColumn]<0.0)
-		    //printf("true els %g (c%d) and %g (c%d)\n",
-		    //   els2[iColumn],complement_[iColumn],
-		    //   els2[jColumn],complement_[jColumn]);
-		  if (fabs(els2[jColumn])>=fabs(els2[iColumn])) {
-		    skipClique=true;
+	  for (int j=gubStart_[iColumn];gubEntry_[j]!=-2;j++) {
+	    int jColumn = gubEntry_[j];
+	    if (jColumn<0) {
+	      // end of clique
+	      if (skipClique)
+		break;
+	      continue;
+	    }
+	    if (!els[jColumn]&&els2[jColumn]&&!complement_[jColumn]) {
+	      //if (els2[iColumn]<0.0||els2[jColumn]<0.0)
+	      //printf("true els %g (c%d) and %g (c%d)\n",
+	      //   els2[iColumn],complement_[iColumn],
+	      //   els2[jColumn],complement_[jColumn]);
+	      if (fabs(els2[jColumn])>=fabs(els2[iColumn])) {
+		skipClique=true;
 #if CGL_DEBUG
-		    if (!found) {
-		      found=true;
-		      printf("Good cut can be improved");
-		      for (i=0;i<n;i++) 
-			printf("(%d,%g) ",ind3[i],els3[i]);
-		      printf("<= %g\n",b);
-		    }
-		    printf("can add! %d %d\n",iColumn,jColumn);
-#endif
-		    els[jColumn]=els[iColumn];
-		    cut.insert(jColumn,els[jColumn]);
-		    // recompute as may have changed
-		    ind3 = cut.getIndices();
-		  }
-		} else if (false&&complement_[jColumn]&&!oneFixesInCliqueEntry(cliqueEntry_[k])) {
-		  printf("COMP true els %g (c%d) and %g (c%d)\n",
-			 els2[iColumn],complement_[iColumn],
-			 els2[jColumn],complement_[jColumn]);
-		  printf("Good cut can be ??");
+		if (!found) {
+		  found=true;
+		  printf("Good cut can be improved");
 		  for (i=0;i<n;i++) 
 		    printf("(%d,%g) ",ind3[i],els3[i]);
 		  printf("<= %g\n",b);
-		  printf("can add?? %d %d\n",iColumn,jColumn);
 		}
+		printf("can add! %d %d\n",iColumn,jColumn);
+#endif
+		els[jColumn]=els[iColumn];
+		cut.insert(jColumn,els[jColumn]);
+		// recompute as may have changed
+		ind3 = cut.getIndices();
 	      }
 	    }
 	  }
@@ -3398,7 +3465,7 @@ CglKnapsackCover::gubifyCut(CoinPackedVector & cut)
 {
   int goodCut=0;
 #ifdef GUBCOVER
-  if (numberCliques_) {
+  if (numberCliques_&&gubStart_) {
     int n = cut.getNumElements();
     const int * ind3;
     const double * els3;
@@ -3412,6 +3479,8 @@ CglKnapsackCover::gubifyCut(CoinPackedVector & cut)
     int numberColumns = solver_->getNumCols();
     double * els = elements_;
     double * els2 = els+numberColumns;
+    if (gubRow_!=whichRow_)
+      setupGubRow();
     bool good = true;
     for (int i=0;i<n;i++) {
       int iColumn = ind3[i];
@@ -3433,46 +3502,44 @@ CglKnapsackCover::gubifyCut(CoinPackedVector & cut)
 #endif
       for (int i=0;i<n;i++) {
 	int iColumn = ind3[i];
-	if (oneFixStart_[iColumn]>=0) {
+	if (gubStart_[iColumn]>=0) {
 	  /* I (JJF) don't think this is valid for more than one clique
 	     Best would be to choose largest set of additions - but that means code
 	     and I don't really understand existing code
 	   */
 	  bool skipClique=false;
-	  for (int j=oneFixStart_[iColumn];j<zeroFixStart_[iColumn];j++) {
-	    if (skipClique)
-	      break;
-	    int iClique = whichClique_[j];
-	    for (int k=cliqueStart_[iClique];k<cliqueStart_[iClique+1];k++) {
-	      int jColumn = sequenceInCliqueEntry(cliqueEntry_[k]);
-	      if (!els[jColumn]&&els2[jColumn]) {
-		assert (jColumn!=iColumn);
-		if (!complement_[jColumn]&&oneFixesInCliqueEntry(cliqueEntry_[k])) {
-		  //if (els2[iColumn]<0.0||els2[jColumn]<0.0)
-		  //printf("true els %g (c%d) and %g (c%d)\n",
-		  //   els2[iColumn],complement_[iColumn],
-		  //   els2[jColumn],complement_[jColumn]);
-		  if (fabs(els2[jColumn])>=fabs(els2[iColumn])) {
-		    skipClique=true;
+	  for (int j=gubStart_[iColumn];gubEntry_[j]!=-2;j++) {
+	    int jColumn = gubEntry_[j];
+	    if (jColumn<0) {
+	      // end of clique
+	      if (skipClique)
+		break;
+	      continue;
+	    }
+	    if (!els[jColumn]&&els2[jColumn]&&!complement_[jColumn]) {
+	      //if (els2[iColumn]<0.0||els2[jColumn]<0.0)
+	      //printf("true els %g (c%d) and %g (c%d)\n",
+	      //   els2[iColumn],complement_[iColumn],
+	      //   els2[jColumn],complement_[jColumn]);
+	      if (fabs(els2[jColumn])>=fabs(els2[iColumn])) {
+		skipClique=true;
 #if CGL_DEBUG
-		    if (!found) {
-		      found=true;
-		      printf("Good cut can be improved");
-		      for (int i=0;i<n;i++) 
-			printf("(%d,%g) ",ind3[i],els3[i]);
-		      //printf("<= %g\n",b);
-		    }
-		    printf("can add! %d %d\n",iColumn,jColumn);
+		if (!found) {
+		  found=true;
+		  printf("Good cut can be improved");
+		  for (int i=0;i<n;i++) 
+		    printf("(%d,%g) ",ind3[i],els3[i]);
+		  //printf("<= %g\n",b);
+		}
+		printf("can add! %d %d\n",iColumn,jColumn);
 #endif
-		    goodCut=1;
+		goodCut=1;
 #if 1
-		    els[jColumn]=els[iColumn];
-		    cut.insert(jColumn,els[jColumn]);
-		    // recompute as may have changed
-		    ind3 = cut.getIndices();
+		els[jColumn]=els[iColumn];
+		cut.insert(jColumn,els[jColumn]);
+		// recompute as may have changed
+		ind3 = cut.getIndices();
 #endif
-		  }
-		}
 	      }
 	    }
 	  }
@@ -3492,6 +3559,117 @@ CglKnapsackCover::gubifyCut(CoinPackedVector & cut)
 #endif
   return goodCut;
 }
+/* Set up clique partition of current row for gub lifting.
+   For each column in row this lists (clique by clique) the other columns
+   in row which can not be one at same time, so lifting of each cut from
+   row only looks at row and not at whole cliques.
+   The partition of each row is kept in gubRowCache_ as
+   number in row, columns of row, start in entries for each (or -1),
+   entries.  It only depends on columns of row and on cliques, so it is
+   used again while row has same columns (deleteCliques clears cache).
+*/
+void 
+CglKnapsackCover::setupGubRow()
+{
+#ifdef GUBCOVER
+  const CoinPackedMatrix * matrixByRow = solver_->getMatrixByRow();
+  const double * elementByRow = matrixByRow->getElements();
+  const int * column = matrixByRow->getIndices();
+  const CoinBigIndex * rowStart = matrixByRow->getVectorStarts();
+  const int * rowLength = matrixByRow->getVectorLengths();
+  int numberColumns = solver_->getNumCols();
+  double * els2 = elements_+numberColumns;
+  CoinBigIndex start=rowStart[whichRow_];
+  int n=rowLength[whichRow_];
+  int k;
+  // take out last row
+  if (gubRow_>=0) {
+    const int * last = gubRowCache_[gubRow_];
+    for (k=0;k<last[0];k++) 
+      gubStart_[last[1+k]]=-1;
+  }
+  gubRow_=whichRow_;
+  int * block = gubRowCache_[whichRow_];
+  if (block) {
+    bool same = (block[0]==n);
+    for (k=0;k<n&&same;k++) {
+      if (block[1+k]!=column[start+k])
+	same=false;
+    }
+    if (!same) {
+      delete [] block;
+      block=NULL;
+    }
+  }
+  if (!block) {
+    numberGubSetups_++;
+    for (k=0;k<n;k++) 
+      els2[column[start+k]]=elementByRow[start+k];
+    // first pass to count (overestimate)
+    int numberEntries=0;
+    for (k=0;k<n;k++) {
+      int iColumn = column[start+k];
+      if (iColumn<numberColumns_&&oneFixStart_[iColumn]>=0) {
+	for (int j=oneFixStart_[iColumn];j<zeroFixStart_[iColumn];j++) {
+	  int iClique = whichClique_[j];
+	  numberEntries += cliqueStart_[iClique+1]-cliqueStart_[iClique]+1;
+	}
+	numberEntries++;
+      }
+    }
+    block = new int [2*n+1+numberEntries];
+    block[0]=n;
+    int * entry = block+2*n+1;
+    numberEntries=0;
+    for (k=0;k<n;k++) {
+      int iColumn = column[start+k];
+      block[1+k]=iColumn;
+      block[1+n+k]=-1;
+      if (iColumn<numberColumns_&&oneFixStart_[iColumn]>=0) {
+	int startColumn=numberEntries;
+	for (int j=oneFixStart_[iColumn];j<zeroFixStart_[iColumn];j++) {
+	  int iClique = whichClique_[j];
+	  int startClique=numberEntries;
+	  for (int kk=cliqueStart_[iClique];kk<cliqueStart_[iClique+1];kk++) {
+	    int jColumn = sequenceInCliqueEntry(cliqueEntry_[kk]);
+	    if (jColumn!=iColumn&&els2[jColumn]&&
+		oneFixesInCliqueEntry(cliqueEntry_[kk])) 
+	      entry[numberEntries++]=jColumn;
+	  }
+	  // only keep cliques which can do something
+	  if (numberEntries>startClique)
+	    entry[numberEntries++]=-1;
+	}
+	if (numberEntries>startColumn) {
+	  entry[numberEntries++]=-2;
+	  block[1+n+k]=startColumn;
+	}
+      }
+    }
+    for (k=0;k<n;k++) 
+      els2[column[start+k]]=0.0;
+    gubRowCache_[whichRow_]=block;
+  }
+  for (k=0;k<n;k++) 
+    gubStart_[block[1+k]]=block[1+n+k];
+  gubEntry_=block+2*n+1;
+#endif
+}
+// Delete gub information kept for rows
+void 
+CglKnapsackCover::deleteGubRows()
+{
+  for (int i=0;i<numberGubRows_;i++)
+    delete [] gubRowCache_[i];
+  delete [] gubRowCache_;
+  delete [] gubStart_;
+  gubRowCache_=NULL;
+  gubStart_=NULL;
+  gubEntry_=NULL;
+  gubRow_=-1;
+  numberGubRows_=0;
+  numberGubColumns_=0;
+}
 
 //-------------------------------------------------------------------
 // A goto-less implementation of the Horowitz-Sahni exact solution 
@@ -3657,6 +3835,13 @@ expensiveCuts_(false)
   zeroFixStart_=NULL;
   endFixStart_=NULL;
   whichClique_=NULL;
+  gubRow_=-1;
+  gubStart_=NULL;
+  gubEntry_=NULL;
+  gubRowCache_=NULL;
+  numberGubRows_=0;
+  numberGubColumns_=0;
+  numberGubSetups_=0;
   canDoGlobalCuts_=true;
 }
 
@@ -3714,6 +3899,13 @@ CglKnapsackCover::CglKnapsackCover (const CglKnapsackCover & source) :
     endFixStart_=NULL;
     whichClique_=NULL;
   }
+  gubRow_=-1;
+  gubStart_=NULL;
+  gubEntry_=NULL;
+  gubRowCache_=NULL;
+  numberGubRows_=0;
+  numberGubColumns_=0;
+  numberGubSetups_=0;
 }
 
 //-------------------------------------------------------------------
@@ -4162,4 +4354,6 @@ CglKnapsackCover::deleteCliques()
   endFixStart_=NULL;
   whichClique_=NULL;
   numberCliques_=0;
+  // gub information of rows depends on cliques
+  deleteGubRows();
 }
@@ -26,6 +26,21 @@ public:
   */
   virtual void generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 			    const CglTreeInfo info = CglTreeInfo());
+  /** Generate knapsack cover cuts for several points.  Points other than
+      current state of si are put in turn on one copy of si, so row copy
+      of copy and gub partition of each row (see setupGubRow) are set up
+      for first point and used for the rest.
+  */
+  virtual void generateCutsMulti(const OsiSolverInterface & si,
+				 int numberPoints,
+				 const double * const * solutions,
+				 const double * const * lowers,
+				 const double * const * uppers,
+				 OsiCuts * cs,
+				 const CglTreeInfo info = CglTreeInfo());
+  /// Cuts only depend on solution, bounds and matrix
+  virtual bool needsOnlySolution() const
+  { return true; }
   //@}
 
   /**@name Constructors and destructors */
@@ -227,6 +242,13 @@ void liftUpDownAndUncomplementAndAdd(
       int * x);
   /// For testing gub stuff
   int gubifyCut(CoinPackedVector & cut);
+  /** Set up clique partition of current row (whichRow_) for gub lifting.
+      Only done when row changes so shared by all cuts from row.  Partition
+      of each row is kept between calls and used again if columns of row
+      are unchanged */
+  void setupGubRow();
+  /// Delete gub information kept for rows
+  void deleteGubRows();
 public:
   /** Creates cliques for use by probing.
       Only cliques >= minimumSize and < maximumSize created
@@ -285,6 +307,23 @@ private:
   int * endFixStart_;
   /// Clique numbers for one or zero fixes
   int * whichClique_;
+  /// Row for which gub information is valid (-1 if none)
+  int gubRow_;
+  /** For each column in gubRow_ start of its entries in gubEntry_ or -1.
+      Entries are for each clique (with a one fix) the other columns of row
+      in that clique followed by -1, and list is ended by -2 */
+  int * gubStart_;
+  /// Gub entries (of gubRow_ in gubRowCache_)
+  int * gubEntry_;
+  /** Gub information kept for each row (or NULL) - number in row,
+      columns of row, start in entries for each column, entries */
+  int ** gubRowCache_;
+  /// Number of rows in gubRowCache_
+  int numberGubRows_;
+  /// Number of columns in gubStart_
+  int numberGubColumns_;
+  /// Number of times gub information of a row was computed
+  int numberGubSetups_;
   /// Number of columns
   int numberColumns_;
   /** For each column with nonzero in row copy this gives a clique "number".
@@ -12,6 +12,7 @@
 #include "CoinPragma.hpp"
 #include "CglKnapsackCover.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
 
 //--------------------------------------------------------------------------
 void
@@ -493,6 +494,28 @@ CglKnapsackCoverUnitTest(
     
     // Test generateCuts method
     kccg.generateCuts(*siP,cuts);
+
+    // Same cuts for several points through multi-point interface -
+    // second point has x20 down
+    {
+      double * childSolution = CoinCopyOfArray(mycs,nCols);
+      childSolution[20]=0.0;
+      OsiSolverInterface * child = siP->clone();
+      child->setColUpper(20,0.0);
+      child->setColSolution(childSolution);
+      const double * solutions[2] = { siP->getColSolution(), childSolution };
+      const double * uppers[2] = { NULL, child->getColUpper() };
+      OsiCuts csMulti[2];
+      kccg.generateCutsMulti(*siP,2,solutions,NULL,uppers,csMulti);
+      OsiCuts csChild;
+      kccg.generateCuts(*child,csChild);
+      assert (csMulti[0].sizeRowCuts()==cuts.sizeRowCuts());
+      assert (csMulti[1].sizeRowCuts()==csChild.sizeRowCuts());
+      for (i=0;i<csChild.sizeRowCuts();i++)
+	assert (csMulti[1].rowCut(i)==csChild.rowCut(i));
+      delete child;
+      delete [] childSolution;
+    }
     OsiSolverInterface::ApplyCutsReturnCode rc = siP->applyCuts(cuts);
     
     siP->resolve();
@@ -534,6 +557,63 @@ CglKnapsackCoverUnitTest(
     delete siP;
   } 
 
+  // Miplib3 problem p0033 again with cliques for gub lifting
+  // Test that no cuts chop off the optimal solution and that gub
+  // information of a row is kept until row changes
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    std::string fn(mpsDir+"p0033");
+    siP->readMps(fn.c_str(),"mps");
+    CglKnapsackCover kccg;
+    siP->initialSolve();
+    kccg.refreshSolver(siP);
+    
+    OsiCuts cuts;    
+    kccg.generateCuts(*siP,cuts);
+    int numberSetups = kccg.numberGubSetups_;
+    assert (numberSetups>0);
+    
+    int objIndices[14] = { 
+       0,  6,  7,  9, 13, 17, 18,
+      22, 24, 25, 26, 27, 28, 29 };
+    CoinPackedVector p0033(14,objIndices,1.0);
+    int nRowCuts = cuts.sizeRowCuts();
+    for (i=0; i<nRowCuts; i++){
+      OsiRowCut rcut = cuts.rowCut(i);
+      CoinPackedVector rpv = rcut.row();
+      double p0033Sum = (rpv*p0033).sum();
+      assert (p0033Sum <= rcut.ub() );
+    }
+    // same LP - all rows taken from cache
+    OsiCuts cuts2;
+    kccg.generateCuts(*siP,cuts2);
+    assert (kccg.numberGubSetups_==numberSetups);
+    assert (cuts2.sizeRowCuts()==nRowCuts);
+    // changed bounds - rows are same so kept
+    int nRows=siP->getNumRows();
+    int ** saveCache = CoinCopyOfArray(kccg.gubRowCache_,nRows);
+    siP->setColUpper(objIndices[0],0.0);
+    siP->resolve();
+    OsiCuts cuts3;
+    kccg.generateCuts(*siP,cuts3);
+    for (i=0;i<nRows;i++) {
+      if (saveCache[i])
+	assert (kccg.gubRowCache_[i]==saveCache[i]);
+    }
+    delete [] saveCache;
+    siP->setColUpper(objIndices[0],1.0);
+    // first row gone - others move up so must be set up again
+    numberSetups = kccg.numberGubSetups_;
+    int firstRow=0;
+    siP->deleteRows(1,&firstRow);
+    siP->resolve();
+    OsiCuts cuts4;
+    kccg.generateCuts(*siP,cuts4);
+    assert (kccg.numberGubSetups_>numberSetups);
+  
+    delete siP;
+  }
+
   // if a debug file is there then look at it
   {
     FILE * fp = fopen("knapsack.debug","r");
@@ -9,6 +9,7 @@
 //---------------------------------------------------------------------------
 #include "CglLandP.hpp"
 #include "CglLandPSimplex.hpp"
+#include "CglSolutionDigest.hpp"
 #include "OsiRowCutDebugger.hpp"
 
 #define INT_INFEAS(value) fabs(value - floor(value+0.5))
@@ -52,6 +53,7 @@ CglLandP::Parameters::Parameters():
         extraCutsLimit(5),
 	maximumCandidates(1000000),
 	maximumCutLength(10000),
+        fullPricingFrequency(1),
         pivotTol(1e-4),
         away(5e-4),
         timeLimit(COIN_DBL_MAX),
@@ -63,6 +65,7 @@ CglLandP::Parameters::Parameters():
         countMistakenRc(false),
         sepSpace(Fractional),
         perturb(true),
+        warmStart(false),
         normalization(Unweighted),
         rhsWeightType(Fixed),
         lhs_norm(L1),
@@ -82,6 +85,7 @@ CglLandP::Parameters::Parameters(const Parameters &other):
         extraCutsLimit(other.extraCutsLimit),
 	maximumCandidates(other.maximumCandidates),
 	maximumCutLength(other.maximumCutLength),
+        fullPricingFrequency(other.fullPricingFrequency),
         pivotTol(other.pivotTol),
         away(other.away),
         timeLimit(other.timeLimit),
@@ -93,6 +97,7 @@ CglLandP::Parameters::Parameters(const Parameters &other):
         countMistakenRc(other.countMistakenRc),
         sepSpace(other.sepSpace),
         perturb(other.perturb),
+        warmStart(other.warmStart),
         normalization(other.normalization),
         rhsWeightType(other.rhsWeightType),
         lhs_norm(other.lhs_norm),
@@ -113,6 +118,7 @@ CglLandP::Parameters & CglLandP::Parameters::operator=(const Parameters &other)
         extraCutsLimit = other.extraCutsLimit;
 	maximumCandidates = other.maximumCandidates;
 	maximumCutLength = other.maximumCutLength;
+        fullPricingFrequency = other.fullPricingFrequency;
         pivotTol = other.pivotTol;
         away = other.away;
         timeLimit = other.timeLimit;
@@ -124,6 +130,7 @@ CglLandP::Parameters & CglLandP::Parameters::operator=(const Parameters &other)
         countMistakenRc = other.countMistakenRc;
         sepSpace = other.sepSpace;
         perturb = other.perturb;
+        warmStart = other.warmStart;
         normalization = other.normalization;
         rhsWeightType = other.rhsWeightType;
         lhs_norm = other.lhs_norm;
@@ -432,7 +439,8 @@ CglLandP::CglLandP(const CglLandP::Parameters &params,
         params_(params), cached_(), validator_(validator), numcols_(-1),
         originalColLower_(NULL), originalColUpper_(NULL),
         canLift_(false),
-        extraCuts_()
+        extraCuts_(), lastPivots_(), numberReplayedPivots_(0),
+        numberPartialPricings_(0)
 {
     handler_ = new CoinMessageHandler();
     handler_->setLogLevel(0);
@@ -455,7 +463,9 @@ CglLandP::CglLandP(const CglLandP & source):
         validator_(source.validator_), numcols_(source.numcols_),
         originalColLower_(NULL), originalColUpper_(NULL),
         canLift_(source.canLift_),
-        extraCuts_(source.extraCuts_)
+        extraCuts_(source.extraCuts_), lastPivots_(source.lastPivots_),
+        numberReplayedPivots_(source.numberReplayedPivots_),
+        numberPartialPricings_(source.numberPartialPricings_)
 {
     handler_ = new CoinMessageHandler();
     handler_->setLogLevel(source.handler_->logLevel());
@@ -481,6 +491,9 @@ CglLandP& CglLandP::operator=(const CglLandP &rhs)
         cached_ = rhs.cached_;
         validator_ = rhs.validator_;
         extraCuts_ = rhs.extraCuts_;
+        lastPivots_ = rhs.lastPivots_;
+        numberReplayedPivots_ = rhs.numberReplayedPivots_;
+        numberPartialPricings_ = rhs.numberPartialPricings_;
     }
     return *this;
 }
@@ -532,9 +545,12 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
                        const CglTreeInfo info )
 {
     int numberRanges = 0;
+    numberReplayedPivots_ = 0;
+    numberPartialPricings_ = 0;
     if ((info.pass == 0) && !info.inTree)
     {
       numrows_ = si.getNumRows();
+      lastPivots_.clear();
       // but switch off? if ranges
       const double * rowLower = si.getRowLower();
       const double * rowUpper = si.getRowUpper();
@@ -552,6 +568,9 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
     } else if (params_.maximumCutLength < 0) {
       return;
     }
+    // Nothing to do if shared digest has no integer far enough from integer
+    if (CglSolutionDigest::noneFractional(si, info, params_.away))
+      return;
 // scanExtraCuts(cs, si.getColSolution());
     Parameters params = params_;
     params.rhsWeight = numrows_ + 2;
@@ -729,7 +748,17 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
         }
         else
         {
-            generated = landpSi.optimize(iRow, cut, cached_, params);
+            const std::vector<LapPivot> * warmPivots = NULL;
+            if (params.warmStart)
+            {
+                std::map<int, std::vector<LapPivot> >::const_iterator found =
+                    lastPivots_.find(cached_.basics_[iRow]);
+                if (found != lastPivots_.end())
+                    warmPivots = &found->second;
+            }
+            generated = landpSi.optimize(iRow, cut, cached_, params, warmPivots);
+            numberReplayedPivots_ += landpSi.numberReplayed();
+            numberPartialPricings_ += landpSi.numberPartialPricings();
             if (params.generateExtraCuts == CglLandP::AllViolatedMigs)
             {
                 landpSi.genThisBasisMigs(cached_, params);
@@ -760,6 +789,14 @@ CglLandP::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
         {
             landpSi.freeSi();
         }
+        if (params.warmStart)
+        {
+            // remember how the cut was obtained (a Gomory cut after a failure has no pivots)
+            if (code || landpSi.pivots().empty())
+                lastPivots_.erase(cached_.basics_[iRow]);
+            else
+                lastPivots_[cached_.basics_[iRow]] = landpSi.pivots();
+        }
         if (code)
         {
             handler_->message(CUT_REJECTED, messages_)<<
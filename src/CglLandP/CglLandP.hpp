@@ -15,6 +15,8 @@
 #include "CglParam.hpp"
 
 #include <iostream>
+#include <map>
+#include <vector>
 class CoinWarmStartBasis;
 /** Performs one round of Lift & Project using CglLandPSimplex
     to build cuts
@@ -42,6 +44,15 @@ public:
     /** destructor.*/
     virtual ~LapMessages() {}
 };
+/** A pivot of the lift-and-project simplex, given by the indices of the variables
+    (structurals then slacks) entering and leaving the basis and the bound at which
+    the leaving variable goes out (1 upper, -1 lower).*/
+struct LapPivot
+{
+    int incoming;
+    int leaving;
+    int direction;
+};
 class CglLandPSimplex;
 }
 
@@ -134,6 +145,10 @@ public:
 	int maximumCandidates;
 	/// Maximum size of cut
 	int maximumCutLength;
+        /** Number of pivots between two computations of the reduced costs of all the rows
+            (with mostNegativeRc, in between rows are chosen from the last computed ones).
+          \default 1 */
+        int fullPricingFrequency;
         ///@}
         /// @name double parameters
         ///@{
@@ -163,6 +178,9 @@ public:
         SeparationSpaces sepSpace;
         /** Apply perturbation procedure. */
         bool perturb;
+        /** Start the pivots for a variable from those which gave its cut at the previous call
+          \default false */
+        bool warmStart;
         /** How to weight normalization.*/
         Normalization normalization;
         /** How to weight RHS of normalization.*/
@@ -233,6 +251,16 @@ public:
     {
         return params_;
     }
+    /** Number of pivots replayed from warm start in the last call to generateCuts.*/
+    int numberReplayedPivots() const
+    {
+        return numberReplayedPivots_;
+    }
+    /** Number of leaving rows chosen by partial pricing in the last call to generateCuts.*/
+    int numberPartialPricings() const
+    {
+        return numberPartialPricings_;
+    }
 private:
 
 
@@ -302,6 +330,12 @@ private:
     bool canLift_;
     /** Store some extra cut which could be cheaply generated but do not cut current incumbent.*/
     OsiCuts extraCuts_;
+    /** Pivots which led to the last cut of each variable (for warm starting).*/
+    std::map<int, std::vector<LAP::LapPivot> > lastPivots_;
+    /** Number of pivots replayed from warm start in the last call to generateCuts.*/
+    int numberReplayedPivots_;
+    /** Number of leaving rows chosen by partial pricing in the last call to generateCuts.*/
+    int numberPartialPricings_;
 };
 CGLLIB_EXPORT
 void CglLandPUnitTest(OsiSolverInterface *si, const std::string & mpsDir);
@@ -223,7 +223,12 @@ CglLandPSimplex::CglLandPSimplex(const OsiSolverInterface &si,
         validator_(validator),
         numPivots_(0),
         numSourceRowEntered_(0),
-        numIncreased_(0)
+        numIncreased_(0),
+        freshReducedCosts_(false),
+        randomGenerator_(987654321),
+        pivots_(),
+        numReplayed_(0),
+        numPartialPricings_(0)
 {
     ncols_orig_ = si.getNumCols();
     nrows_orig_ = si.getNumRows();
@@ -280,6 +285,11 @@ CglLandPSimplex::CglLandPSimplex(const OsiSolverInterface &si,
         rWk3_.resize(nrows_orig_);
         rWk4_.resize(nrows_orig_);
         rIntWork_.resize(nrows_orig_);
+        rLoBound_.resize(nrows_orig_);
+        rUpBound_.resize(nrows_orig_);
+        rColsol_.resize(nrows_orig_);
+        rColsolToCut_.resize(nrows_orig_);
+        rNormedSigma_.resize(nrows_orig_);
 
         row_i_.reserve(rowsize);
         rowFlags_ = new bool[nrows_orig_];
@@ -621,7 +631,8 @@ CglLandPSimplex::generateMig(int row, OsiRowCut & cut,
 
 bool
 CglLandPSimplex::optimize
-(int row, OsiRowCut & cut,const CglLandP::CachedData &cached,const CglLandP::Parameters & params)
+(int row, OsiRowCut & cut,const CglLandP::CachedData &cached,const CglLandP::Parameters & params,
+ const std::vector<LapPivot> * warmPivots)
 {
     bool optimal = false;
     int nRowFailed = 0;
@@ -633,6 +644,10 @@ CglLandPSimplex::optimize
     /** Copy the cached information */
     nrows_ = nrows_orig_;
     ncols_ = ncols_orig_;
+    randomGenerator_.setSeed(987654321 + row);
+    pivots_.clear();
+    numReplayed_ = 0;
+    numPartialPricings_ = 0;
     CoinCopyN(cached.basics_, nrows_, basics_);
     CoinCopyN(cached.nonBasics_, ncols_, nonBasics_);
     CoinCopyN(cached.colsol_, nrows_+ ncols_, colsol_);
@@ -697,16 +712,32 @@ CglLandPSimplex::optimize
     //Put a flag on each row to say if we want to continue trying to use it
     CoinFillN(rowFlags_,nrows_,true);
 
+    int numPivots = 0;
+    // start from the basis which gave the previous cut for this variable
+    // (replayed pivots count against the pivot limit)
+    if (warmPivots != NULL && params.pivotLimit > 0)
+    {
+        int numReplayed = replayPivots(*warmPivots, params, params.pivotLimit);
+        if (numReplayed < 0)
+            return 0;
+        numReplayed_ = numReplayed;
+        numPivots = numReplayed;
+        if (numReplayed)
+            freshReducedCosts_ = false;
+    }
+
     int numberConsecutiveDegenerate = 0;
     bool allowDegeneratePivot = numberConsecutiveDegenerate < params.degeneratePivotLimit;
     bool beObstinate = 0;
-    int numPivots = 0;
     int saveNumSourceEntered = numSourceRowEntered_;
     int saveNumIncreased = numIncreased_;
     int numCycle = 0;
     int numFailedPivots = 0;
     bool hasFlagedRow = false;
     int maxTryRow = 5;
+    int pivotsSincePricing = 0;
+    // rows flagged while choosing from tables of an earlier pricing
+    bool staleFlags = false;
     while (  !optimal && numPivots < params.pivotLimit)
     {
         if (timeLimit - CoinCpuTime() < 0.) break;
@@ -720,8 +751,28 @@ CglLandPSimplex::optimize
         double bestSigma;
         if (params.pivotSelection != CglLandP::initialReducedCosts || numPivots == 0)
         {
-            leaving = fastFindCutImprovingPivotRow(direction, gammaSign, params.pivotTol,
-                                                   params.pivotSelection == CglLandP::initialReducedCosts);
+            // partial pricing: between two full pricings only look at the
+            // rows which had a negative reduced cost at the last one
+            bool partialPricing = params.pivotSelection == CglLandP::mostNegativeRc &&
+                                  pivotsSincePricing > 0 &&
+                                  pivotsSincePricing < params.fullPricingFrequency;
+            if (partialPricing)
+            {
+                leaving = rescanReducedCosts(direction, gammaSign, params.pivotTol);
+                if (leaving >= 0)
+                    numPartialPricings_++;
+            }
+            if (!partialPricing || leaving < 0)
+            {
+                if (staleFlags)
+                {
+                    CoinFillN(rowFlags_,nrows_,true);
+                    staleFlags = false;
+                }
+                leaving = fastFindCutImprovingPivotRow(direction, gammaSign, params.pivotTol,
+                                                       params.pivotSelection == CglLandP::initialReducedCosts);
+                pivotsSincePricing = 0;
+            }
 #if 0
             plotCGLPobj(direction, params.pivotTol, params.pivotTol, true, true, false);
             exit(1);
@@ -746,7 +797,24 @@ CglLandPSimplex::optimize
                         if (incoming == -1 || params.countMistakenRc) nRowFailed ++;
                         rowFlags_[leaving] = false;
                         hasFlagedRow = true;
+                        if (!freshReducedCosts_)
+                            staleFlags = true;
+                        int failedRow = leaving;
                         leaving = rescanReducedCosts(direction, gammaSign, params.pivotTol);
+                        if (leaving < 0 && !freshReducedCosts_)
+                        {
+                            // tables are from an earlier basis - do a full
+                            // pricing before deciding there is no improving row
+                            if (staleFlags)
+                            {
+                                CoinFillN(rowFlags_,nrows_,true);
+                                rowFlags_[failedRow] = false;
+                                staleFlags = false;
+                            }
+                            leaving = fastFindCutImprovingPivotRow(direction, gammaSign, params.pivotTol,
+                                                                   false);
+                            pivotsSincePricing = 0;
+                        }
                         if (leaving >= 0)
                         {
                             incoming = fastFindBestPivotColumn(direction, gammaSign,
@@ -817,7 +885,7 @@ CglLandPSimplex::optimize
                                             fabs(gamma) < 1e-05));
 #endif
 
-                std::pair<int, int> cur_pivot(nonBasics_[incoming],basics_[leaving]);
+                LapPivot cur_pivot = {nonBasics_[incoming], basics_[leaving], direction};
 
                 bool pivoted = changeBasis(incoming,leaving,direction,
 #ifndef OLD_COMPUTATION
@@ -836,6 +904,15 @@ CglLandPSimplex::optimize
                 if (pivoted)
                 {
                     numPivots++;
+                    pivotsSincePricing++;
+                    pivots_.push_back(cur_pivot);
+                    freshReducedCosts_ = false;
+                    // with partial pricing the tables are rescanned without
+                    // row flags - basic variable of leaving row has changed so
+                    // remove it from candidates (initialReducedCosts flags it)
+                    if (params.pivotSelection == CglLandP::mostNegativeRc &&
+                            params.fullPricingFrequency > 1)
+                        rWk1_[leaving] = rWk2_[leaving] = rWk3_[leaving] = rWk4_[leaving] = 10.;
 
                     double lastSigma = sigma_;
                     if (params.modularize)
@@ -943,6 +1020,90 @@ CglLandPSimplex::optimize
 }
 
 
+/** Redo the pivots of a previous call to optimize. A pivot is only redone if its variables
+    are still nonbasic and basic, the pivot element is not too small and it decreases sigma,
+    the first pivot which fails these checks stops the replay (any basis gives a valid cut).
+    If the solver fails to do a pivot, sigma is recomputed as after a failed pivot in optimize
+    and -1 is returned.*/
+int
+CglLandPSimplex::replayPivots(const std::vector<LapPivot> & warmPivots,
+                              const CglLandP::Parameters & params,
+                              int maxPivots)
+{
+    double infty = si_->getInfinity();
+    int numVars = ncols_ + nrows_;
+    int numReplayed = 0;
+    for (unsigned int p = 0 ; p < warmPivots.size() && numReplayed < maxPivots ; p++)
+    {
+        const LapPivot & pivot = warmPivots[p];
+        if (pivot.incoming < 0 || pivot.incoming >= numVars ||
+                pivot.leaving < 0 || pivot.leaving >= numVars ||
+                col_in_subspace[pivot.incoming] == false ||
+                col_in_subspace[pivot.leaving] == false)
+            break;
+        if (pivot.direction > 0 ? getUpBound(pivot.leaving) >= infty :
+                getLoBound(pivot.leaving) <= -infty)
+            break;
+        int incoming = -1;
+        for (int j = 0 ; j < ncols_ ; j++)
+        {
+            if (nonBasics_[j] == pivot.incoming)
+            {
+                incoming = j;
+                break;
+            }
+        }
+        int leaving = -1;
+        for (int i = 0 ; i < nrows_ ; i++)
+        {
+            if (basics_[i] == pivot.leaving)
+            {
+                leaving = i;
+                break;
+            }
+        }
+        if (incoming < 0 || leaving < 0 || leaving == row_k_.num)
+            break;
+
+        row_i_.num = leaving;
+        pullTableauRow(row_i_);
+        adjustTableauRow(pivot.leaving, row_i_, pivot.direction);
+        if (fabs(row_i_[pivot.incoming]) < params.pivotTol)
+        {
+            resetOriginalTableauRow(pivot.leaving, row_i_, pivot.direction);
+            break;
+        }
+        double gamma = - row_k_[pivot.incoming] / row_i_[pivot.incoming];
+        if (computeCglpObjective(gamma, false) >= sigma_ - 1e-07)
+        {
+            resetOriginalTableauRow(pivot.leaving, row_i_, pivot.direction);
+            break;
+        }
+        if (!changeBasis(incoming, leaving, pivot.direction,
+#ifndef OLD_COMPUTATION
+                         true,
+#endif
+                         false))
+        {
+            // same as a failed pivot in optimize: give up this cut
+            double lastSigma = sigma_;
+            sigma_ = computeCglpObjective(row_k_);
+            if ( sigma_-lastSigma>1e-8)
+                handler_->message(PivotFailedSigmaIncreased,messages_)<<CoinMessageEol<<CoinMessageEol;
+            else
+                handler_->message(PivotFailedSigmaUnchanged,messages_)<<CoinMessageEol<<CoinMessageEol;
+            return -1;
+        }
+        pivots_.push_back(pivot);
+        numReplayed++;
+        if (params.modularize)
+            row_k_.modularize(integers_);
+        sigma_ = computeCglpObjective(row_k_);
+    }
+    return numReplayed;
+}
+
+
 bool
 CglLandPSimplex::changeBasis(int incoming, int leaving, int leavingStatus,
 #ifndef OLD_COMPUTATION
@@ -1390,10 +1551,11 @@ CglLandPSimplex::fastFindCutImprovingPivotRow( int &direction, int &gammaSign,
     //Need to get the column of the tableau in rW3_ for each of these and
     //add up with correctly in storage for multiplier for negative gamma (named rW3_) and
     //for positive gamma (which is named rW4_)
+    //(always cleared so that the pricing loop below does not depend on M3_)
+    CoinFillN(&rWk3_[0],nrows_,0.);
+    CoinFillN(&rWk4_[0],nrows_,0.);
     if (!M3_.empty())
     {
-        CoinFillN(&rWk3_[0],nrows_,0.);
-        CoinFillN(&rWk4_[0],nrows_,0.);
         if (modularize)
         {
             double * rWk3bis_ = NULL;
@@ -1455,172 +1617,115 @@ CglLandPSimplex::fastFindCutImprovingPivotRow( int &direction, int &gammaSign,
     //for (int i = 0 ; i < ncols_orig_ ; i++) {
     //  fzero -= getColsolToCut(nonBasics_[i]) * row_k_[nonBasics_[i]];
     //}
-
-    double bestReducedCost = -tolerance;
+    const double oneMinusFzero = 1 - fzero;
+
+    // Gather the data of the basic variables in structure of arrays form so
+    // that the reduced costs of all the rows are computed in one branch free
+    // loop (which the compiler can vectorize).
+    // Rows which are not considered get infinite bounds (hence no reduced cost).
+    double * loBound = &rLoBound_[0];
+    double * upBound = &rUpBound_[0];
+    double * colsol = &rColsol_[0];
+    double * colsolToCut = &rColsolToCut_[0];
+    double * normedSigma = &rNormedSigma_[0];
     for (int i = 0 ; i < nrows_ ; i++)
     {
+        const int & ii = basics_[i];
+        colsol[i] = colsol_[ii];
+        colsolToCut[i] = getColsolToCut(ii);
+        normedSigma[i] = normedCoef(sigma, ii);
       //if ((!row_k_.modularized_ && i == row_k_.num)//obviously not necessary to combine row k with itself
         if ((i == row_k_.num)//obviously not necessary to combine row k with itself
                 //   && fabs(getUpBound(basics_[row_i_.num]) - getLoBound(basics_[row_i_.num]))>1e-09 //variable is not fixed
-                || col_in_subspace[basics_[i]] == false
+                || col_in_subspace[ii] == false
            )
         {
-            ul_i[i]=uu_i[i]=vl_i[i]=vu_i[i]=10.;
+            loBound[i] = -COIN_DBL_MAX;
+            upBound[i] = COIN_DBL_MAX;
             rowFlags_[i] = false;
-            continue;
         }
-
-        double tau1 = rWk1_[i];
-        double tau2 = rWk1_[i];
-        double tau3 = rWk1_[i];
-        double tau4 = rWk1_[i];
-        if (!M3_.empty())
-        {
-            tau1 += rWk3_[i];
-            tau2 += rWk4_[i];
-            tau3 += rWk4_[i];
-            tau4 += rWk3_[i];
-        }
-        if (modularize)
+        else
         {
-            tau1 = rWk1_[i] + rWk3_[i];
-            tau2 = rWk1bis_[i] + rWk3_[i];
-            tau3 = - rWk1_[i] - rWk4_[i];
-            tau4 = - rWk1bis_[i] - rWk3_[i];
+            loBound[i] = getLoBound(ii);
+            upBound[i] = getUpBound(ii);
         }
+    }
 
-
-        double redCost;
-        bool hasNegativeRc = false;
-
-        double loBound = getLoBound(basics_[i]);
-
-        if (loBound > -1e50)
+    // Compute the four reduced costs of each row, only negative ones are kept
+    // (others are set to 10.)
+    for (int i = 0 ; i < nrows_ ; i++)
+    {
+        const double tau1 = rWk1_[i] + rWk3_[i];
+        const double tau2 = rWk1_[i] + rWk4_[i];
+        const double tau3 = tau2;
+        const double tau4 = tau1;
+        const double lo = loBound[i];
+        const double up = upBound[i];
+        const bool hasLo = lo > -1e50;
+        const bool hasUp = up < 1e50;
+
+        const double rc_ul = - normedSigma[i] + (tau1)
+                             + oneMinusFzero * ( colsol[i] - lo);
+        const double rc_vl = - normedSigma[i] - (tau2)
+                             - oneMinusFzero * ( colsol[i] - lo)
+                             - lo + colsolToCut[i];
+        const double rc_uu = - normedSigma[i] - (tau3)
+                             + oneMinusFzero * ( - colsol[i] + up);
+        const double rc_vu = - normedSigma[i] + (tau4)
+                             - oneMinusFzero * ( - colsol[i] + up)
+                             + up - colsolToCut[i];
+
+        ul_i[i] = (hasLo && rc_ul < -tolerance) ? rc_ul : 10.;
+        vl_i[i] = (hasLo && rc_vl < -tolerance) ? rc_vl : 10.;
+        uu_i[i] = (hasUp && rc_uu < -tolerance) ? rc_uu : 10.;
+        vu_i[i] = (hasUp && rc_vu < -tolerance) ? rc_vu : 10.;
+
+        nZeroRc += (hasLo && fabs(rc_ul) < tolerance) + (hasLo && fabs(rc_vl) < tolerance)
+                   + (hasUp && fabs(rc_uu) < tolerance) + (hasUp && fabs(rc_vu) < tolerance);
+        nPositiveRc += (hasLo && rc_ul >= tolerance) + (hasLo && rc_vl >= tolerance)
+                       + (hasUp && rc_uu >= tolerance) + (hasUp && rc_vu >= tolerance);
+    }
+
+    // Pick the most negative reduced cost among rows which are not flagged
+    double bestReducedCost = -tolerance;
+    for (int i = 0 ; i < nrows_ ; i++)
+    {
+        bool hasNegativeRc = ul_i[i] < 0. || vl_i[i] < 0. || uu_i[i] < 0. || vu_i[i] < 0.;
+        if (rowFlags_[i])   //row has not been flaged
         {
-            redCost = - normedCoef(sigma,basics_[i]) + (tau1)
-                      + (1 - fzero) * ( colsol_[basics_[i]]
-                                        - loBound);
-
-
-            if (redCost < -tolerance)
-            {
-                ul_i[i] = redCost;
-                hasNegativeRc = true;
-            }
-            else
-            {
-                if (fabs(redCost) < tolerance) nZeroRc++;
-                else nPositiveRc ++;
-                ul_i[i] = 10.;
-            }
-            if (redCost < bestReducedCost
-                    && rowFlags_[i] )   //row has not been flaged
+            if (ul_i[i] < bestReducedCost)
             {
                 bestDirection = -1;
                 bestGammaSign = -1;
-                bestReducedCost = redCost;
+                bestReducedCost = ul_i[i];
                 bestRow = i;
             }
-
-
-            redCost = -normedCoef(sigma,basics_[i]) - (tau2)
-                      - (1 - fzero) * ( colsol_[basics_[i]]
-                                        - loBound)
-                      - loBound + getColsolToCut(basics_[i]);
-
-            if (redCost < -tolerance)
-            {
-                vl_i[i] = redCost;
-                hasNegativeRc = true;
-            }
-            else
-            {
-                if (fabs(redCost) < tolerance) nZeroRc++;
-                else nPositiveRc ++;
-                vl_i[i]=10.;
-            }
-
-            if (redCost < bestReducedCost
-                    && rowFlags_[i])   //row has not been flaged
+            if (vl_i[i] < bestReducedCost)
             {
                 bestDirection = -1;
                 bestGammaSign = 1;
-                bestReducedCost = redCost;
+                bestReducedCost = vl_i[i];
                 bestRow = i;
             }
-
-
-
-        }
-        else
-        {
-            ul_i[i] = 10.;
-            vl_i[i] = 10.;
-        }
-        double upBound = getUpBound(basics_[i]);
-        if (getUpBound(basics_[i]) < 1e50)
-        {
-            redCost = - normedCoef(sigma,basics_[i]) - (tau3)
-                      + (1 - fzero) * ( - colsol_[basics_[i]]
-                                        + upBound);
-
-            if (redCost < -tolerance)
-            {
-                uu_i[i] = redCost;
-                hasNegativeRc = true;
-            }
-            else
-            {
-                if (fabs(redCost) < tolerance) nZeroRc++;
-                else nPositiveRc ++;
-                uu_i[i] = 10.;
-            }
-
-            if (redCost < bestReducedCost
-                    && rowFlags_[i])   //row has not been flaged
+            if (uu_i[i] < bestReducedCost)
             {
                 bestDirection = 1;
                 bestGammaSign = -1;
-                bestReducedCost = redCost;
+                bestReducedCost = uu_i[i];
                 bestRow = i;
             }
-
-            redCost = -normedCoef(sigma,basics_[i]) + (tau4)
-                      - (1 - fzero) * ( - colsol_[basics_[i]]
-                                        + upBound)
-                      + upBound - getColsolToCut(basics_[i]);
-
-            if (redCost < -tolerance)
-            {
-                vu_i[i] = redCost;
-                hasNegativeRc = true;
-            }
-
-
-            else
-            {
-                if (fabs(redCost) < tolerance) nZeroRc++;
-                else nPositiveRc ++;
-                vu_i[i] = 10.;
-            }
-
-            if (redCost < bestReducedCost
-                    && rowFlags_[i])   //row has not been flaged
+            if (vu_i[i] < bestReducedCost)
             {
                 bestDirection = 1;
                 bestGammaSign = 1;
-                bestReducedCost = redCost;
+                bestReducedCost = vu_i[i];
                 bestRow = i;
             }
         }
-        else
-        {
-            uu_i[i] = 10.;
-            vu_i[i] = 10.;
-        }
         if (hasNegativeRc) nNegativeRcRows_ ++;
         else if (flagPositiveRows) rowFlags_[i] = false;
     }
+    freshReducedCosts_ = true;
     handler_->message(NumberNegRc, messages_)<<nNegativeRcRows_<<CoinMessageEol;
     handler_->message(NumberZeroRc, messages_)<<nZeroRc<<CoinMessageEol;
     handler_->message(NumberPosRc, messages_)<<nPositiveRc<<CoinMessageEol;
@@ -1903,7 +2008,7 @@ CglLandPSimplex::fastFindBestPivotColumn(int direction, int gammaSign,
     int lastValid = -1;
 #ifndef NDEBUG
     bool rc_positive=false;
-    if (M3_.size())
+    if (M3_.size() && freshReducedCosts_)
         DblEqAssert( gammaSign*(q * r - p * s)/r, chosenReducedCostVal_);
 #endif
     if ( gammaSign*(q * r - p * s) >= 0)
@@ -2532,7 +2637,7 @@ CglLandPSimplex::updateM1_M2_M3(TabRow & row, double tolerance, bool perturb)
             {
                 if (perturb)   //assign to M1 or M2 at random
                 {
-                    int sign = CoinDrand48() > 0.5 ? 1 : -1;
+                    int sign = randomGenerator_.randomDouble() > 0.5 ? 1 : -1;
                     if (sign == -1)   //put into M1
                     {
                         M1_.push_back(ii);
@@ -21,6 +21,7 @@
 #include "CoinMessageHandler.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
 
 #ifdef CGL_HAS_OSICLP
 #include "OsiClpSolverInterface.hpp"
@@ -52,8 +53,24 @@ public:
     void cacheUpdate(const CglLandP::CachedData &cached, bool reducedSpace = 0);
     /** reset the solver to optimal basis */
     bool resetSolver(const CoinWarmStartBasis * basis);
-    /** Perfom pivots to find the best cuts */
-    bool optimize(int var, OsiRowCut & cut, const CglLandP::CachedData &cached, const CglLandP::Parameters & params);
+    /** Perfom pivots to find the best cuts (first replaying \a warmPivots if given) */
+    bool optimize(int var, OsiRowCut & cut, const CglLandP::CachedData &cached, const CglLandP::Parameters & params,
+                  const std::vector<LapPivot> * warmPivots = NULL);
+    /** Pivots performed by the last call to optimize.*/
+    const std::vector<LapPivot> & pivots() const
+    {
+        return pivots_;
+    }
+    /** Number of pivots of the last call to optimize which were replayed from warm start.*/
+    int numberReplayed() const
+    {
+        return numReplayed_;
+    }
+    /** Number of leaving rows of the last call to optimize chosen by partial pricing.*/
+    int numberPartialPricings() const
+    {
+        return numPartialPricings_;
+    }
     /** Find Gomory cut (i.e. don't do extra setup required for pivots).*/
     bool generateMig(int row, OsiRowCut &cut, const CglLandP::Parameters & params);
 
@@ -200,6 +217,11 @@ protected:
     void adjustTableauRow(int var, TabRow & row, int direction);
     /** reset the tableau row after a call to adjustTableauRow */
     void resetOriginalTableauRow(int var, TabRow & row, int direction);
+    /** Redo the pivots of a previous call to optimize (at most \a maxPivots) as long as they
+        are possible in the current basis and decrease sigma. Return the number of pivots done,
+        or -1 if the solver failed to do one (the cut should then be given up).*/
+    int replayPivots(const std::vector<LapPivot> & warmPivots, const CglLandP::Parameters & params,
+                     int maxPivots);
     /**Get lower bound for variable or constraint */
     inline double getLoBound(int index) const
     {
@@ -313,6 +335,20 @@ private:
     std::vector<double> rWk4_;
     /** integer valued work vector on the rows */
     std::vector<int> rIntWork_;
+    /** @name Data of the basic variable of each row gathered for pricing
+        (structure of arrays, see fastFindCutImprovingPivotRow) */
+    /** @{ */
+    /** lower bound (-infinity if row is not priced).*/
+    std::vector<double> rLoBound_;
+    /** upper bound (+infinity if row is not priced).*/
+    std::vector<double> rUpBound_;
+    /** value in current basic solution.*/
+    std::vector<double> rColsol_;
+    /** value in solution to cut.*/
+    std::vector<double> rColsolToCut_;
+    /** normed sigma.*/
+    std::vector<double> rNormedSigma_;
+    /** @} */
     /** Flag rows which we don't want to try anymore */
     bool * rowFlags_;
     /** Flag columns which are in the subspace (usualy remove nonbasic structurals in subspace) */
@@ -385,6 +421,18 @@ private:
     int numSourceRowEntered_;
     /** Record the number of times that sigma increased.*/
     int numIncreased_;
+    /** Say if the tables of reduced costs correspond to the current basis
+        (they do not after a pivot until the next full pricing).*/
+    bool freshReducedCosts_;
+    /** Random numbers for perturbation, reseeded from the source row
+        in optimize so that each cut does not depend on the others.*/
+    CoinThreadRandom randomGenerator_;
+    /** Pivots performed in the current call to optimize.*/
+    std::vector<LapPivot> pivots_;
+    /** Number of pivots replayed from warm start in the current call to optimize.*/
+    int numReplayed_;
+    /** Number of leaving rows chosen by partial pricing in the current call to optimize.*/
+    int numPartialPricings_;
 
     /** Message handler. */
     CoinMessageHandler * handler_;
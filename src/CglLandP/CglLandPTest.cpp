@@ -40,6 +40,8 @@ CglLandPUnitTest(
         assert(aGenerator.parameter().strengthen==true);
         assert(aGenerator.parameter().perturb==true);
         assert(aGenerator.parameter().pivotSelection==CglLandP::mostNegativeRc);
+        assert(aGenerator.parameter().fullPricingFrequency==1);
+        assert(aGenerator.parameter().warmStart==false);
     }
 
 
@@ -61,6 +63,8 @@ CglLandPUnitTest(
             b.parameter().strengthen = false;
             b.parameter().perturb = false;
             b.parameter().pivotSelection=CglLandP::bestPivot;
+            b.parameter().fullPricingFrequency = 5;
+            b.parameter().warmStart = true;
             //Test Copy
             CglLandP c(b);
             assert(c.parameter().pivotLimit == 100);
@@ -76,6 +80,8 @@ CglLandPUnitTest(
             assert(c.parameter().strengthen == false);
             assert(c.parameter().perturb == false);
             assert(c.parameter().pivotSelection == CglLandP::bestPivot);
+            assert(c.parameter().fullPricingFrequency == 5);
+            assert(c.parameter().warmStart == true);
             a=b;
             assert(a.parameter().pivotLimit == 100);
             assert(a.parameter().maxCutPerRound == 100);
@@ -90,6 +96,8 @@ CglLandPUnitTest(
             assert(a.parameter().strengthen == false);
             assert(a.parameter().perturb == false);
             assert(a.parameter().pivotSelection == CglLandP::bestPivot);
+            assert(a.parameter().fullPricingFrequency == 5);
+            assert(a.parameter().warmStart == true);
         }
     }
 
@@ -306,6 +314,42 @@ CglLandPUnitTest(
         delete siP;
     }
 
+    if (1)  //test partial pricing and warm start
+    {
+        // Setup
+        OsiSolverInterface  * siP = si->clone();
+        std::string fn(mpsDir+"p0033");
+        siP->readMps(fn.c_str(),"mps");
+        siP->activateRowCutDebugger("p0033");
+        CglLandP test;
+        test.parameter().fullPricingFrequency = 5;
+        test.parameter().warmStart = true;
+        siP->initialSolve();
+        double lpRelaxBefore=siP->getObjValue();
+        assert( eq(lpRelaxBefore, 2520.5717391304347) );
+
+        CglTreeInfo info;
+        OsiCuts cuts;
+        info.pass = 0;
+        test.generateCuts(*siP,cuts,info);
+        // leaving rows are taken from tables of earlier pricings
+        assert(test.numberPartialPricings() > 0);
+        assert(test.numberReplayedPivots() == 0);
+        // on the same LP the pivots which gave the cuts are redone
+        OsiCuts cuts2;
+        info.pass = 1;
+        test.generateCuts(*siP,cuts2,info);
+        assert(test.numberReplayedPivots() > 0);
+        siP->applyCuts(cuts2);
+        siP->resolve();
+        double lpRelaxAfter = siP->getObjValue();
+
+        std::cout<<"Relaxation after "<<lpRelaxAfter<<std::endl;
+        assert( lpRelaxBefore < lpRelaxAfter );
+
+        delete siP;
+    }
+
     if (1)  //Finally test code in documentation
     {
         // Setup
@@ -29,30 +29,7 @@ CglMixedIntegerRounding::generateCuts(const OsiSolverInterface& si,
 				      const CglTreeInfo )
 {
 
-  // If the LP or integer presolve is used, then need to redo preprocessing
-  // everytime this function is called. Otherwise, just do once.
-  bool preInit = false;
-  bool preReso = false;
-  si.getHintParam(OsiDoPresolveInInitial, preInit);
-  si.getHintParam(OsiDoPresolveInResolve, preReso);
-  if (preInit == false &&  preReso == false && doPreproc_ == -1 ) { // Do once
-    if (doneInitPre_ == false) {   
-      mixIntRoundPreprocess(si);
-      doneInitPre_ = true;
-    }
-  }
-  else {
-    if(doPreproc_ == 1){ // Do everytime       
-      mixIntRoundPreprocess(si);
-      doneInitPre_ = true;
-    } 
-    else {
-      if (doneInitPre_ == false) {   
-	mixIntRoundPreprocess(si);
-	doneInitPre_ = true;
-      }  
-    }
-  }
+  preprocessIfNeeded(si);
 
   const double* xlp        = si.getColSolution();  // LP solution
   const double* colUpperBound = si.getColUpper();  // vector of upper bounds
@@ -86,6 +63,100 @@ CglMixedIntegerRounding::generateCuts(const OsiSolverInterface& si,
 		  cs);
 }
 
+//-------------------------------------------------------------------
+// Generate Mixed Integer Rounding inequalities for several points
+//------------------------------------------------------------------- 
+void
+CglMixedIntegerRounding::generateCutsMulti(const OsiSolverInterface& si,
+					   int numberPoints,
+					   const double * const * solutions,
+					   const double * const * lowers,
+					   const double * const * uppers,
+					   OsiCuts* cs,
+					   const CglTreeInfo )
+{
+  if (numberPoints <= 0)
+    return;
+
+  // Row types, variable bounds and matrices do not depend on point
+  preprocessIfNeeded(si);
+
+  const CoinPackedMatrix & tempMatrixByRow = *si.getMatrixByRow();
+  CoinPackedMatrix matrixByRow;
+  matrixByRow.submatrixOf(tempMatrixByRow, numRows_, indRows_);
+  CoinPackedMatrix matrixByCol = matrixByRow;
+  matrixByCol.reverseOrdering();
+  const double* coefByRow  = matrixByRow.getElements();
+  const int* colInds       = matrixByRow.getIndices();
+  const CoinBigIndex* rowStarts     = matrixByRow.getVectorStarts();
+  const int* rowLengths    = matrixByRow.getVectorLengths();
+  const double* coefByCol  = matrixByCol.getElements();
+  const int* rowInds       = matrixByCol.getIndices();
+  const CoinBigIndex* colStarts     = matrixByCol.getVectorStarts();
+  const int* colLengths    = matrixByCol.getVectorLengths();
+
+  // Row activities of all points in one pass over rows
+  double* LHS = new double [numberPoints*numRows_];
+  CoinZeroN(LHS, numberPoints*numRows_);
+  for (int iRow = 0; iRow < numRows_; ++iRow) {
+    for (CoinBigIndex j = rowStarts[iRow];
+	 j < rowStarts[iRow] + rowLengths[iRow]; ++j) {
+      const int iColumn = colInds[j];
+      const double value = coefByRow[j];
+      double* lhs = LHS + iRow;
+      for (int k = 0; k < numberPoints; ++k) {
+	*lhs += value * solutions[k][iColumn];
+	lhs += numRows_;
+      }
+    }
+  }
+
+  for (int k = 0; k < numberPoints; ++k) {
+    const double* colLowerBound = (lowers && lowers[k]) ?
+      lowers[k] : si.getColLower();
+    const double* colUpperBound = (uppers && uppers[k]) ?
+      uppers[k] : si.getColUpper();
+    generateMirCuts(si, solutions[k], colUpperBound, colLowerBound,
+		    matrixByRow, LHS + k*numRows_, coefByRow,
+		    colInds, rowStarts, rowLengths,
+		    coefByCol, rowInds, colStarts, colLengths,
+		    cs[k]);
+  }
+  delete [] LHS;
+}
+
+//-------------------------------------------------------------------
+// Do preprocessing if needed
+//------------------------------------------------------------------- 
+void
+CglMixedIntegerRounding::preprocessIfNeeded(const OsiSolverInterface& si)
+{
+  // If the LP or integer presolve is used, then need to redo preprocessing
+  // everytime this function is called. Otherwise, just do once.
+  bool preInit = false;
+  bool preReso = false;
+  si.getHintParam(OsiDoPresolveInInitial, preInit);
+  si.getHintParam(OsiDoPresolveInResolve, preReso);
+  if (preInit == false &&  preReso == false && doPreproc_ == -1 ) { // Do once
+    if (doneInitPre_ == false) {   
+      mixIntRoundPreprocess(si);
+      doneInitPre_ = true;
+    }
+  }
+  else {
+    if(doPreproc_ == 1){ // Do everytime       
+      mixIntRoundPreprocess(si);
+      doneInitPre_ = true;
+    } 
+    else {
+      if (doneInitPre_ == false) {   
+	mixIntRoundPreprocess(si);
+	doneInitPre_ = true;
+      }  
+    }
+  }
+}
+
 //-------------------------------------------------------------------
 // Default Constructor 
 //-------------------------------------------------------------------
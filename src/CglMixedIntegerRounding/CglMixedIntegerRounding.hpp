@@ -128,6 +128,17 @@ public:
   */
   virtual void generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 			    const CglTreeInfo info = CglTreeInfo());
+  /** Generate Mixed Integer Rounding cuts for several points.
+      Preprocessing and row and column copies are done once and
+      row activities of all points are found in one pass over rows.
+  */
+  virtual void generateCutsMulti(const OsiSolverInterface & si,
+				 int numberPoints,
+				 const double * const * solutions,
+				 const double * const * lowers,
+				 const double * const * uppers,
+				 OsiCuts * cs,
+				 const CglTreeInfo info = CglTreeInfo());
   //@}
 
   //---------------------------------------------------------------------------
@@ -230,6 +241,9 @@ private:
   // It may change sense and RHS for ranged rows
   void mixIntRoundPreprocess(const OsiSolverInterface& si);
 
+  // Do preprocessing if it has not been done or has to be redone
+  void preprocessIfNeeded(const OsiSolverInterface& si);
+
   // Determine the type of a given row.
   RowType determineRowType(const OsiSolverInterface& si,
 			   const int rowLen, const int* ind, 
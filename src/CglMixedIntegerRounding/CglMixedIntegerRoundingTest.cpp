@@ -3,6 +3,7 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 #include <cstdio>
+#include <cmath>
 
 #ifdef NDEBUG
 #undef NDEBUG
@@ -81,6 +82,45 @@ CglMixedIntegerRoundingUnitTest(const OsiSolverInterface *baseSiP,
       int nRowCuts = cs.sizeRowCuts();
       std::cout<<"There are "<<nRowCuts<<" MIR cuts"<<std::endl;
       assert(cs.sizeRowCuts() > 0);
+
+      // LP optimum and a branch down on a fractional integer through
+      // multi-point interface - same cuts as generateCuts on each
+      {
+	int nCols = siP->getNumCols();
+	const double * x = siP->getColSolution();
+	int iColumn;
+	for (iColumn = 0; iColumn < nCols; iColumn++) {
+	  if (siP->isInteger(iColumn) &&
+	      fabs(x[iColumn] - floor(x[iColumn] + 0.5)) > 1.0e-4)
+	    break;
+	}
+	assert(iColumn < nCols);
+	OsiSolverInterface * child = siP->clone();
+	child->setColUpper(iColumn, floor(x[iColumn]));
+	child->resolve();
+	assert(child->isProvenOptimal());
+	const double * solutions[2];
+	const double * lowers[2];
+	const double * uppers[2];
+	solutions[0] = siP->getColSolution();
+	lowers[0] = NULL;
+	uppers[0] = NULL;
+	solutions[1] = child->getColSolution();
+	lowers[1] = child->getColLower();
+	uppers[1] = child->getColUpper();
+	assert(solutions[1][iColumn] < x[iColumn] - 1.0e-4);
+	OsiCuts csMulti[2];
+	gct.generateCutsMulti(*siP, 2, solutions, lowers, uppers, csMulti);
+	OsiCuts csChild;
+	gct.generateCuts(*child, csChild);
+	assert(csMulti[0].sizeRowCuts() == nRowCuts);
+	assert(csMulti[1].sizeRowCuts() == csChild.sizeRowCuts());
+	for (int i = 0; i < nRowCuts; i++)
+	  assert(csMulti[0].rowCut(i) == cs.rowCut(i));
+	for (int i = 0; i < csChild.sizeRowCuts(); i++)
+	  assert(csMulti[1].rowCut(i) == csChild.rowCut(i));
+	delete child;
+      }
       OsiSolverInterface::ApplyCutsReturnCode rc = siP->applyCuts(cs);
       
       siP->resolve();
@@ -12,6 +12,7 @@
 //#include <cmath>
 //#include <cstdlib>
 #include <cassert>
+#include <algorithm>
 
 #include "CoinPragma.hpp"
 #include "CoinHelperFunctions.hpp"
@@ -1246,9 +1247,6 @@ CglMixedIntegerRounding2::cMirSeparation(
 
   bool generated = false;
   double numeratorBeta = rhsMixedKnapsack;
-  CoinIndexedVector * cMIR = &workVectors[0];
-  cMIR->copy(mixedKnapsack);
-  double rhscMIR;
   double maxViolation = 0.0;
   double bestDelta = 0.0;
   CoinIndexedVector * bestCut = &workVectors[1];
@@ -1260,6 +1258,24 @@ CglMixedIntegerRounding2::cMirSeparation(
   const int *contVarInSIndices = contVariablesInS.getIndices();
   const double *contVarInSElements = contVariablesInS.denseVector();
 
+  // Knapsack data by position so candidates can be evaluated
+  // without forming inequalities
+  double * elements = new double [4*numInt];
+  double * xValues = elements + numInt;
+  double * upperValues = xValues + numInt;
+  double * deltas = upperValues + numInt;
+  char * inC = new char [2*numInt];
+  char * evaluated = inC + numInt;
+  int j;
+  for ( j = 0; j < numInt; ++j) {
+    const int indCol = knapsackIndices[j];
+    elements[j] = knapsackElements[indCol];
+    xValues[j] = xlp[indCol];
+    upperValues[j] = colUpperBound[indCol];
+    inC[j] = 0;
+    evaluated[j] = 0;
+  }
+
   // Construct set C, T will be the rest.
   // Also, for T we construct a CoinIndexedVector named complT which
   // contains the vars in T that are strictly between their bounds
@@ -1268,20 +1284,19 @@ CglMixedIntegerRounding2::cMirSeparation(
   CoinIndexedVector * complT = &workVectors[2];
   complT->clear();
   double infinity = si.getInfinity();
-  int j;
   for ( j = 0; j < numInt; ++j) {
-    const int indCol = knapsackIndices[j];
     // if the upper bound is infinity, then indCol is in T and cannot
     // be in complT
-    if (colUpperBound[indCol] != infinity) {
-      if (xlp[indCol] >= colUpperBound[indCol] / 2.0) {
+    if (upperValues[j] != infinity) {
+      if (xValues[j] >= upperValues[j] / 2.0) {
 	setC.insert(j,1.0);
-	numeratorBeta -= knapsackElements[indCol] * colUpperBound[indCol];
+	inC[j] = 1;
+	numeratorBeta -= elements[j] * upperValues[j];
       } else {
-	if ( (xlp[indCol] <= EPSILON_) || 
-	     (xlp[indCol] >= colUpperBound[indCol] - EPSILON_))
+	if ( (xValues[j] <= EPSILON_) || 
+	     (xValues[j] >= upperValues[j] - EPSILON_))
 	  continue;
-	complT->insert(j, fabs(xlp[indCol] - colUpperBound[indCol]/2));
+	complT->insert(j, fabs(xValues[j] - upperValues[j]/2));
       }
     }
   }
@@ -1292,29 +1307,34 @@ CglMixedIntegerRounding2::cMirSeparation(
     complT->sortIncrElement();
   }
 
-  // Construct c-MIR inequalities and take the one with the largest violation
+  // Candidate deltas are coefficients of variables strictly between
+  // bounds - only evaluate each different value once
+  int numDeltas = 0;
   for ( j = 0; j < numInt; ++j) {
-    int indCol = knapsackIndices[j];
-    if ( (xlp[indCol] <= EPSILON_) || 
-	 (xlp[indCol] >= colUpperBound[indCol] - EPSILON_))
+    if ( (xValues[j] <= EPSILON_) || 
+	 (xValues[j] >= upperValues[j] - EPSILON_))
       continue;
-    double delta = knapsackElements[indCol];
+    double delta = elements[j];
     // delta has to be positive
     if (delta <= EPSILON_) continue;
-
-    double violation = 0.0;
-    double sCoef = 0.0;
-
-    // form a cMIR inequality
-    cMirInequality(numInt, delta, numeratorBeta, knapsackIndices, 
-		   knapsackElements, xlp, sStar, colUpperBound, setC, *cMIR,
-		   rhscMIR, sCoef, violation);
-
-    // store cut if it is the best found so far
+    deltas[numDeltas++] = delta;
+  }
+  std::sort(deltas, deltas + numDeltas);
+  numDeltas = static_cast<int>(std::unique(deltas, deltas + numDeltas) - deltas);
+  // evaluate all candidates - keep first best as before
+  for ( j = 0; j < numInt; ++j) {
+    if ( (xValues[j] <= EPSILON_) || 
+	 (xValues[j] >= upperValues[j] - EPSILON_))
+      continue;
+    double delta = elements[j];
+    if (delta <= EPSILON_) continue;
+    int k = static_cast<int>(std::lower_bound(deltas, deltas + numDeltas, delta) - deltas);
+    if (evaluated[k])
+      continue; // same value already done
+    evaluated[k] = 1;
+    double violation = cMirViolation(numInt, delta, numeratorBeta, elements,
+				     xValues, upperValues, inC, sStar);
     if (violation > maxViolation + EPSILON_) {
-      bestCut->copy(*cMIR);
-      rhsBestCut = rhscMIR;
-      sCoefBestCut = sCoef;
       maxViolation = violation;
       bestDelta = delta;
     }
@@ -1322,6 +1342,8 @@ CglMixedIntegerRounding2::cMirSeparation(
 
   // if no violated inequality has been found, exit now
   if (maxViolation == 0.0) {
+    delete [] elements;
+    delete [] inC;
     bestCut->clear();
     return generated;
   }
@@ -1331,19 +1353,9 @@ CglMixedIntegerRounding2::cMirSeparation(
   double deltaBase = bestDelta;
   for (int multFactor = 2; multFactor <= 8; multFactor *= 2) {
     double delta = deltaBase / multFactor;
-    double violation = 0.0;
-    double sCoef = 0.0;
-
-    // form a cMIR inequality
-    cMirInequality(numInt, delta, numeratorBeta, knapsackIndices, 
-		   knapsackElements, xlp, sStar, colUpperBound, setC, *cMIR,
-		   rhscMIR, sCoef, violation);
-
-    // store cut if it is the best found so far
+    double violation = cMirViolation(numInt, delta, numeratorBeta, elements,
+				     xValues, upperValues, inC, sStar);
     if (violation > maxViolation + EPSILON_) {
-      bestCut->copy(cMIR);
-      rhsBestCut = rhscMIR;
-      sCoefBestCut = sCoef;
       maxViolation = violation;
       bestDelta = delta;
     }
@@ -1359,33 +1371,37 @@ CglMixedIntegerRounding2::cMirSeparation(
     for (int j = 0; j < complTSize; ++j) {
       // move variable in set complT from set T to set C
       int jIndex = complTIndices[j];
-      int indCol = knapsackIndices[jIndex];
       // do nothing if upper bound is infinity
-      if (colUpperBound[indCol] >= infinity) continue;
-      setC.insert(jIndex,1.0);
-      double violation = 0.0;
-      double sCoef = 0.0;
+      if (upperValues[jIndex] >= infinity) continue;
+      inC[jIndex] = 1;
       double localNumeratorBeta = numeratorBeta -
-	mixedKnapsack[indCol] * colUpperBound[indCol];
+	elements[jIndex] * upperValues[jIndex];
+      double violation = cMirViolation(numInt, bestDelta, localNumeratorBeta,
+				       elements, xValues, upperValues, inC,
+				       sStar);
 
-      // form a cMIR inequality
-      cMirInequality(numInt, bestDelta, localNumeratorBeta, knapsackIndices, 
-		     knapsackElements, xlp, sStar, colUpperBound, setC, *cMIR,
-		     rhscMIR, sCoef, violation);
-
-      // store cut if it is the best found so far; otherwise, move the variable
+      // keep if it is the best found so far; otherwise, move the variable
       // that was added to set C back to set T
       if (violation > maxViolation + EPSILON_) {
-	bestCut->copy(cMIR);
-	rhsBestCut = rhscMIR;
-	sCoefBestCut = sCoef;
+	setC.insert(jIndex,1.0);
 	maxViolation = violation;
 	numeratorBeta = localNumeratorBeta;
+      } else {
+	inC[jIndex] = 0;
       }
-      else
-	setC.quickAdd(jIndex,-1.0);
     }
   }
+  delete [] elements;
+  delete [] inC;
+
+  // now form the winning inequality
+  {
+    double violation = 0.0;
+    bestCut->copy(mixedKnapsack);
+    cMirInequality(numInt, bestDelta, numeratorBeta, knapsackIndices, 
+		   knapsackElements, xlp, sStar, colUpperBound, setC, *bestCut,
+		   rhsBestCut, sCoefBestCut, violation);
+  }
 
   // write the best cut found with the model variables
   int numCont = contVariablesInS.getNumElements();
@@ -1629,6 +1645,43 @@ CglMixedIntegerRounding2::cMirInequality(
 }
 
 
+//-------------------------------------------------------------------
+// violation of a c-MIR inequality (same arithmetic as cMirInequality)
+//-------------------------------------------------------------------
+double
+CglMixedIntegerRounding2::cMirViolation(
+				  const int numInt,
+				  const double delta,
+				  const double numeratorBeta,
+				  const double* elements,
+				  const double* xValues,
+				  const double* upperValues,
+				  const char* inC,
+				  const double sStar) const
+{
+  double beta = numeratorBeta / delta;
+  double f = beta - floor(beta);
+  double rhs = floor(beta);
+  double violation = 0.0;
+  double normCut = 0.0;
+  for (int i = 0; i < numInt; ++i) {
+    if (!inC[i]) {
+      double G = functionG(elements[i] / delta, f);
+      violation += G * xValues[i];
+      normCut += G * G;
+    } else {
+      double G = functionG( - elements[i] / delta, f);
+      violation -= G * xValues[i];
+      normCut += G * G;
+      rhs -= G * upperValues[i];
+    }
+  }
+  double sCoef = 1.0 / (delta * (1.0 - f));
+  violation -= (rhs + sCoef * sStar);
+  normCut += sCoef * sCoef;
+  return violation / sqrt(normCut);
+}
+
 //-------------------------------------------------------------------
 // function G for computing coefficients in cMIR inequality
 //-------------------------------------------------------------------
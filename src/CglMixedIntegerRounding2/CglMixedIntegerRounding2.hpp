@@ -332,6 +332,17 @@ private:
 		       double& sCoef,
 		       double& violation) const;
 
+  // violation of one c-MIR inequality without forming it - knapsack
+  // data is by position in knapsack, inC nonzero for members of set C
+  double cMirViolation( const int numInt,
+			const double delta,
+			const double numeratorBeta,
+			const double* elements,
+			const double* xValues,
+			const double* upperValues,
+			const char* inC,
+			const double sStar) const;
+
   // function to compute G
   inline double functionG( const double d, const double f ) const;
 
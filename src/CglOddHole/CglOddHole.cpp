@@ -7,6 +7,7 @@
 #include <cmath>
 #include <cfloat>
 #include <iostream>
+#include <set>
 
 #include "CoinPragma.hpp"
 #include "CoinHelperFunctions.hpp"
@@ -14,6 +15,7 @@
 #include "CoinPackedMatrix.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include "CglOddHole.hpp"
+#include "CglSolutionDigest.hpp"
 //#define CGL_DEBUG
 // We may want to sort cut
 typedef struct {double dj;double element; int sequence;} 
@@ -31,6 +33,9 @@ public:
 void CglOddHole::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 			      const CglTreeInfo info)
 {
+  // Nothing to do if shared digest has all binaries fixed at 0 or 1
+  if (CglSolutionDigest::noneFractional(si, info, epsilon_))
+    return;
   // Get basic problem information
   int nRows=si.getNumRows(); 
   int nCols=si.getNumCols(); 
@@ -44,6 +49,7 @@ void CglOddHole::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
   // If it does then suitable rows are subset of information
   
   CglOddHole temp;
+  temp.maximumPops_=maximumPops_;
   int * checkRow = new int[nRows];
   int i;
   if (!suitableRows_) {
@@ -290,16 +296,13 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
   }
   //random numbers to winnow out duplicate cuts
   double * check = new double[nCols];
-  if (info.randomNumberGenerator) {
-    const CoinThreadRandom * randomGenerator = info.randomNumberGenerator;
-    for (i=0;i<nCols;i++) {
-      check[i]=randomGenerator->randomDouble();
-    }
-  } else {
-    CoinSeedRandom(13579);
-    for (i=0;i<nCols;i++) {
-      check[i]=CoinDrand48(); // NOT on a thread by thread basis
-    }
+  // if no generator passed in use a local one - so thread safe and
+  // same numbers on every call
+  CoinThreadRandom localGenerator(13579);
+  const CoinThreadRandom * randomGenerator = info.randomNumberGenerator ?
+    info.randomNumberGenerator : &localGenerator;
+  for (i=0;i<nCols;i++) {
+    check[i]=randomGenerator->randomDouble();
   }
 
   // Shortest path algorithm from Dijkstra - is there a better one?
@@ -316,12 +319,17 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
   Path * path = new Path [nSmall2];
   // arrays below are used only if looks promising
   // allocate here
-  // we don't know how many cuts will be generated
-  int ncuts=0;
-  int maxcuts=1000;
-  double * hash = reinterpret_cast<double *> (malloc(maxcuts*sizeof(double)));
+  // signatures of cuts already generated (to winnow out duplicates)
+  std::set<double> hash;
   // to clean (should not be needed)
   int * clean = new int[nSmall2];
+  // nodes reached from current source (so only they need resetting)
+  int * touched = new int[nSmall2];
+  int j;
+  for (j=0;j<nSmall2;j++) {
+    path[j].cost=1.0e70;
+    path[j].back=nSmall2+1;
+  }
   int * candidate = new int[CoinMax(nSmall2,nCols)];
   double * element = new double[nCols];
   // in case we want to sort
@@ -333,21 +341,37 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
   int bias = packed ? 0 : 1; //amount to add before halving
   // If nSmall large then should do a randomized subset
   // Improvement 1
+  // Bound on nodes looked at from each source - the search is label
+  // correcting so without a bound a source may revisit nodes many times
+  int maximumPops = maximumPops_ ? maximumPops_ : CoinMax(1000,10*nSmall2);
   int icol;
+  int ntouched=0;
   for (icol=0;icol<nSmall;icol++) {
-    int j;
     int jcol=icol+nSmall;
     int istack=1;
-    for (j=0;j<nSmall2;j++) {
-      path[j].cost=1.0e70;
-      path[j].back=nSmall2+1;
+    // reset nodes reached from last source
+    for (j=0;j<ntouched;j++) {
+      int k=touched[j];
+      path[k].cost=1.0e70;
+      path[k].back=nSmall2+1;
     }
+    ntouched=0;
     path[icol].cost=0.0;
     path[icol].back=-1;
+    touched[ntouched++]=icol;
     stack[0].cost=0.0;
     stack[0].node=icol;
     mark[icol]=1;
+    // bound work for this source - any path found is still a real path
+    int npops=0;
     while(istack) {
+      if (npops==maximumPops) {
+	// give up on search - free nodes still on stack
+	while (istack) 
+	  mark[stack[--istack].node]=0;
+	break;
+      }
+      npops++;
       Item thisItem=stack[--istack];
       double thisCost=thisItem.cost;
       int inode=thisItem.node;
@@ -358,6 +382,8 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
       for (k=starts[inode];k<starts[inode+1];k++) {
 	int jnode=to[k];
 	if (!mark[jnode]&&thisCost+cost[k]<path[jnode].cost-1.0e-12) {
+	  if (path[jnode].cost==1.0e70)
+	    touched[ntouched++]=jnode;
 	  path[jnode].cost=thisCost+cost[k];
 	  path[jnode].back=inode;
 	  // add to stack
@@ -529,8 +555,6 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
 	    }
 	  }
 	  if (good) {
-	    //this assumes not many cuts
-	    int j;
 #if 0
 	    double value=0.0;
 	    for (j=0;j<ii;j++) {
@@ -543,19 +567,9 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
             double value = candidatePv.dotProduct(check);
 #endif
 
-	    for (j=0;j<ncuts;j++) {
-	      if (value==hash[j]) {
-		//could check equality - quicker just to assume
-		break;
-	      }
-	    }
-	    if (j==ncuts) {
+	    //could check equality - quicker just to assume
+	    if (hash.insert(value).second) {
 	      //new
-	      if (ncuts==maxcuts) {
-		maxcuts *= 2;
-		hash = reinterpret_cast<double *> (realloc(hash,maxcuts*sizeof(double)));
-	      }
-	      hash[ncuts++]=value;
 	      rc.setRow(ii,candidate,element);
 #ifdef CGL_DEBUG
 	      printf("sum %g rhs %g %d\n",sum,rhs,ii);
@@ -574,10 +588,10 @@ void CglOddHole::generateCuts(const OsiRowCutDebugger * /*debugger*/,
   delete [] element;
   delete [] candidate;
   delete [] sortit;
+  delete [] touched;
   delete [] clean;
   delete [] path;
   delete [] stack;
-  free(hash);
   delete [] check;
   delete [] mark;
   delete [] starts;
@@ -705,6 +719,7 @@ onetol_(1-epsilon_)
   minimumViolation_=0.001;
   minimumViolationPer_=0.0003;
   maximumEntries_=100;
+  maximumPops_=0;
 }
 
 //-------------------------------------------------------------------
@@ -740,6 +755,7 @@ onetol_(source.onetol_)
   minimumViolation_=source.minimumViolation_;
   minimumViolationPer_=source.minimumViolationPer_;
   maximumEntries_=source.maximumEntries_;
+  maximumPops_=source.maximumPops_;
 }
 
 //-------------------------------------------------------------------
@@ -795,6 +811,7 @@ CglOddHole::operator=(
     minimumViolation_=rhs.minimumViolation_;
     minimumViolationPer_=rhs.minimumViolationPer_;
     maximumEntries_=rhs.maximumEntries_;
+    maximumPops_=rhs.maximumPops_;
   }
   return *this;
 }
@@ -834,6 +851,18 @@ CglOddHole::setMaximumEntries(int value)
   if (value>2)
     maximumEntries_=value;
 }
+// Maximum number of nodes looked at in shortest path from each variable
+int 
+CglOddHole::getMaximumPops() const
+{
+  return maximumPops_;
+}
+void 
+CglOddHole::setMaximumPops(int value)
+{
+  if (value>=0)
+    maximumPops_=value;
+}
 
 // This can be used to refresh any inforamtion
 void 
@@ -76,6 +76,12 @@ public:
   /// Maximum number of entries in a cut
   int getMaximumEntries() const;
   void setMaximumEntries(int value);
+  /** Maximum number of nodes looked at in shortest path search from each
+      variable (bounds work on large set packing models).  0 (default)
+      means 10 times the number of nodes in the doubled graph, but at
+      least 1000. */
+  int getMaximumPops() const;
+  void setMaximumPops(int value);
   //@}
 
   /**@name Constructors and destructors */
@@ -140,6 +146,8 @@ private:
   double minimumViolationPer_;
   /// Maximum number of entries in a cut
   int maximumEntries_;
+  /// Maximum number of nodes looked at in each shortest path search (0 automatic)
+  int maximumPops_;
   /// number of rows when suitability tested
   int numberRows_;
   /// number of cliques
@@ -27,6 +27,7 @@ CglOddHoleUnitTest(
   // Test default constructor
   {
     CglOddHole aGenerator;
+    assert (aGenerator.getMaximumPops()==0);
   }
   
   // Test copy & assignment
@@ -34,8 +35,11 @@ CglOddHoleUnitTest(
     CglOddHole rhs;
     {
       CglOddHole bGenerator;
+      bGenerator.setMaximumPops(1000);
       CglOddHole cGenerator(bGenerator);
+      assert (cGenerator.getMaximumPops()==1000);
       rhs=bGenerator;
+      assert (rhs.getMaximumPops()==1000);
     }
   }
 
@@ -69,6 +73,11 @@ CglOddHoleUnitTest(
     CoinPackedVector rpv=cs.rowCut(0).row();
     rpv.sortIncrIndex();
     assert (check==rpv);
+    // bounded search should still find it
+    OsiCuts cs2;
+    test1.setMaximumPops(100);
+    test1.generateCuts(NULL,matrix,sol,dj,cs2,which,fixed,info,true);
+    assert (cs2.sizeRowCuts()==1);
   }
   
   // Testcase /u/rlh/osl2/mps/scOneInt.mps
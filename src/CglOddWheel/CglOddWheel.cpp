@@ -19,6 +19,7 @@
 
 #include <cstdio>
 #include <cassert>
+#include <algorithm>
 
 #include "CglOddWheel.hpp"
 #include "CoinHelperFunctions.hpp"
@@ -50,6 +51,7 @@ CglOddWheel::CglOddWheel(const CglOddWheel& rhs) {
     if (this->cap_ > 0) {
         this->idxs_ = (int*)xmalloc(sizeof(int) * this->cap_);
         this->idxMap_ = (int*)xmalloc(sizeof(int) * this->cap_);
+        std::fill(this->idxMap_, this->idxMap_ + this->cap_, -1);
         this->coefs_ = (double*)xmalloc(sizeof(double) * this->cap_);
         this->x_ = (double*)xmalloc(sizeof(double) * this->cap_ * 2);
         this->rc_ = (double*)xmalloc(sizeof(double) * this->cap_ * 2);
@@ -108,9 +110,14 @@ void CglOddWheel::generateCuts( const OsiSolverInterface & si, OsiCuts & cs, con
     const double *rCost = si.getReducedCost();
     for(size_t i = 0; i < numCols; i++) {
         x_[i] = colSol[i];
-        rc_[i] = rCost[i];
         x_[i + numCols] = 1.0 - x_[i];
-        rc_[i + numCols] = -rc_[i];
+    }
+    //reduced costs are only used when lifting
+    if (extMethod_) {
+        for(size_t i = 0; i < numCols; i++) {
+            rc_[i] = rCost[i];
+            rc_[i + numCols] = -rc_[i];
+        }
     }
 
     CoinOddWheelSeparator oddH(cgraph, x_, rc_, extMethod_);
@@ -131,7 +138,6 @@ void CglOddWheel::generateCuts( const OsiSolverInterface & si, OsiCuts & cs, con
 
         int realSize = 0;
         bool duplicated = false;
-        std::fill(idxMap_, idxMap_ + numCols, -1);
 
         for(size_t k = 0; k < oddSize; k++) {
             if(oddEl[k] < numCols) {
@@ -161,6 +167,7 @@ void CglOddWheel::generateCuts( const OsiSolverInterface & si, OsiCuts & cs, con
         }
 
         if (duplicated) {
+            resetIdxMap(realSize);
             continue;
         }
 
@@ -194,11 +201,13 @@ void CglOddWheel::generateCuts( const OsiSolverInterface & si, OsiCuts & cs, con
             }
 
             if (duplicated) {
+                resetIdxMap(realSize);
                 continue;
             }
         }
 
         cutPool.add(idxs_, coefs_, realSize, rhs);
+        resetIdxMap(realSize);
     }
 
     cutPool.removeNullCuts();
@@ -242,6 +251,8 @@ void CglOddWheel::checkMemory(const size_t newNumCols) {
 
         idxs_ = (int*)xmalloc(sizeof(int) * newNumCols);
         idxMap_ = (int*)xmalloc(sizeof(int) * newNumCols);
+        //idxMap_ is kept at -1 outside generateCuts
+        std::fill(idxMap_, idxMap_ + newNumCols, -1);
         coefs_ = (double*)xmalloc(sizeof(double) * newNumCols);
         x_ = (double*)xmalloc(sizeof(double) * newNumCols * 2);
         rc_ = (double*)xmalloc(sizeof(double) * newNumCols * 2);
@@ -249,6 +260,12 @@ void CglOddWheel::checkMemory(const size_t newNumCols) {
     }
 }
 
+void CglOddWheel::resetIdxMap(const int size) {
+    for (int k = 0; k < size; k++) {
+        idxMap_[idxs_[k]] = -1;
+    }
+}
+
 static void *xmalloc( const size_t size ) {
     void *result = malloc( size );
     if (!result) {
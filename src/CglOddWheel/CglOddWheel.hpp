@@ -99,6 +99,12 @@ private:
    **/
   void checkMemory(const size_t newNumCols);
 
+  /**
+   * Set back to -1 the entries of idxMap_ used
+   * by the first size indexes in idxs_.
+   **/
+  void resetIdxMap(const int size);
+
   /**
    * Capacity of storage of the data structures.
    **/
@@ -18,6 +18,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CglStored.hpp"
 #include "CglCutGenerator.hpp"
+#include "CglImpliedIntegers.hpp"
 #include "CoinTime.hpp"
 #include "CoinSort.hpp"
 #include "CoinDenseFactorization.hpp"
@@ -2944,12 +2945,28 @@ CglPreProcess::preProcessNonDefault(OsiSolverInterface &model,
     writeDebugMps(startModel2, "after", NULL);
     // make as many integer as possible
     int numberChanged = analyze(startModel2);
-    if (numberChanged<0)
+    if (numberChanged<0) {
       infeas = true;
-    else if (numberChanged)
-      handler_->message(CGL_MADE_INTEGER, messages_)
-	<< numberChanged
-	<< CoinMessageEol;
+    } else {
+      // continuous columns forced to be integer by chains of equality rows
+      CglImpliedIntegers implied(*startModel2, 1);
+      if (implied.numberImplied()) {
+	const char *status = implied.status();
+	const double *lower = startModel2->getColLower();
+	const double *upper = startModel2->getColUpper();
+	int numberColumns = startModel2->getNumCols();
+	for (int i = 0; i < numberColumns; i++) {
+	  if (status[i] == 2 && lower[i] < upper[i]) {
+	    startModel2->setInteger(i);
+	    numberChanged++;
+	  }
+	}
+      }
+      if (numberChanged)
+	handler_->message(CGL_MADE_INTEGER, messages_)
+	  << numberChanged
+	  << CoinMessageEol;
+    }
   }
   if (infeas) {
     handler_->message(CGL_INFEASIBLE, messages_)
@@ -5371,9 +5388,31 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
       // was simple presolve
       numberSolvers_ = 1;
     }
+    // mapping to original columns for each pass (only needed for SC)
+    int *originalByPass = NULL;
+    int numberColumns0 = 0;
+    if (scBound) {
+      numberColumns0 =
+        CoinMax(originalModel_->getNumCols(), model_[0]->getNumCols());
+      originalByPass = new int[numberSolvers_ * numberColumns0];
+      int *original = originalByPass;
+      for (int i = 0; i < numberColumns0; i++)
+        original[i] = i;
+      for (int jPass = 1; jPass < numberSolvers_; jPass++) {
+        const int *previous = original;
+        original += numberColumns0;
+        CoinMemcpyN(previous, numberColumns0, original);
+        const int *forward = presolve_[jPass - 1]->originalColumns();
+        int numberColumns = model_[jPass - 1]->getNumCols();
+        for (int i = 0; i < numberColumns; i++)
+          original[i] = previous[forward[i]];
+      }
+    }
     for (int iPass = numberSolvers_ - 1; iPass >= 0; iPass--) {
       OsiSolverInterface *model = model_[iPass];
-      int * original = NULL;
+      const int *original = NULL;
+      if (scBound)
+        original = originalByPass + iPass * numberColumns0;
       if (model->getNumCols()) {
         CoinWarmStartBasis *basis = dynamic_cast< CoinWarmStartBasis * >(modelM->getWarmStart());
         if (basis) {
@@ -5386,23 +5425,10 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
         const double *columnUpper2 = model->getColUpper();
         const double *columnLower = modelM->getColLower();
         const double *columnUpper = modelM->getColUpper();
-	if (scBound) {
-	  int numberColumns0 =
-	    CoinMax(originalModel_->getNumCols(),model_[0]->getNumCols());
-	  original = new int [numberColumns0];
-	  for (int i=0;i<numberColumns0;i++)
-	    original[i]=i;
-	  for (int jPass=0;jPass<iPass;jPass++) {
-	    OsiPresolve * pinfo = presolve_[jPass];
-	    const int *forward = pinfo->originalColumns();
-	    OsiSolverInterface * solver = model_[jPass];
-	    int numberColumns = solver->getNumCols();
-	    for (int i=0;i<numberColumns;i++) {
-	      int iColumn = forward[i];
-	      original[i] = original[iColumn];
-	    }
-	  }
-	}
+        // gather new bounds and set in one go
+        int numberBounds = 0;
+        int *whichBound = new int[numberColumns];
+        double *newBounds = new double[2 * numberColumns];
         int iColumn;
         for (iColumn = 0; iColumn < numberColumns; iColumn++) {
           if (modelM->isInteger(iColumn)) {
@@ -5410,8 +5436,10 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
             double value2 = floor(value + 0.5);
             // if test fails then empty integer
             if (fabs(value - value2) < 1.0e-3) {
-              model->setColLower(iColumn, value2);
-              model->setColUpper(iColumn, value2);
+              whichBound[numberBounds] = iColumn;
+              newBounds[2 * numberBounds] = value2;
+              newBounds[2 * numberBounds + 1] = value2;
+              numberBounds++;
             } else {
 #if CBC_USEFUL_PRINTING > 1
               printf("NPASS=%d, ipass %d var %d values %g %g %g\n",
@@ -5421,17 +5449,25 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
             }
           } else if (columnUpper[iColumn] == columnLower[iColumn]) {
             if (columnUpper2[iColumn] > columnLower2[iColumn] && !model->isInteger(iColumn)) {
-              model->setColUpper(iColumn, columnLower[iColumn]);
-              model->setColLower(iColumn, columnLower[iColumn]);
+              whichBound[numberBounds] = iColumn;
+              newBounds[2 * numberBounds] = columnLower[iColumn];
+              newBounds[2 * numberBounds + 1] = columnLower[iColumn];
+              numberBounds++;
             }
 	  } else if (scBound) {
 	    int jColumn = original[iColumn];
 	    if (scBound[jColumn]!=-COIN_DBL_MAX) {
-	      double lower =scBound[jColumn];
-              model->setColLower(iColumn, lower);
+              whichBound[numberBounds] = iColumn;
+              newBounds[2 * numberBounds] = scBound[jColumn];
+              newBounds[2 * numberBounds + 1] = columnUpper2[iColumn];
+              numberBounds++;
 	    }
           }
         }
+        if (numberBounds)
+          model->setColSetBounds(whichBound, whichBound + numberBounds, newBounds);
+        delete[] whichBound;
+        delete[] newBounds;
       }
       int numberColumns = modelM->getNumCols();
       const double *solutionM = modelM->getColSolution();
@@ -5530,55 +5566,122 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
 	  printf("ZZ not feasible??\n");
       }
 #endif
+      /* If every column is fixed (usual for pure integer problems) the
+         LP is trivial - bounds are the solution and the slack basis with
+         zero row duals is optimal, so reduced costs are the objective.
+         Put that in and let postsolve recover values instead of solving
+         (the original model is solved at the end anyway).  Postsolve
+         takes row activities and reduced costs from the solver, so if
+         the solver does not give back A*x and c - A'y we solve. */
+      bool solved = false;
       {
-        int numberFixed = 0;
         int numberColumns = model->getNumCols();
+        int numberRows = model->getNumRows();
         const double *columnLower = model->getColLower();
         const double *columnUpper = model->getColUpper();
         int iColumn;
         for (iColumn = 0; iColumn < numberColumns; iColumn++) {
-          if (columnLower[iColumn] == columnUpper[iColumn])
-            numberFixed++;
+          if (columnLower[iColumn] != columnUpper[iColumn])
+            break;
         }
-        if (numberColumns > 2000 && numberFixed < numberColumns && numberFixed * 5 > numberColumns) {
-          model->setHintParam(OsiDoPresolveInInitial, true, OsiHintTry);
+        if (numberColumns && iColumn == numberColumns) {
+          double primalTolerance;
+          model->getDblParam(OsiPrimalTolerance, primalTolerance);
+          double *rowActivity = new double[numberRows];
+          CoinZeroN(rowActivity, numberRows);
+          model->getMatrixByCol()->times(columnLower, rowActivity);
+          const double *rowLower = model->getRowLower();
+          const double *rowUpper = model->getRowUpper();
+          int iRow;
+          for (iRow = 0; iRow < numberRows; iRow++) {
+            if (rowActivity[iRow] < rowLower[iRow] - primalTolerance || rowActivity[iRow] > rowUpper[iRow] + primalTolerance)
+              break;
+          }
+          if (iRow == numberRows) {
+            model->setColSolution(columnLower);
+            double *dual = new double[numberRows];
+            CoinZeroN(dual, numberRows);
+            model->setRowPrice(dual);
+            delete[] dual;
+            CoinWarmStartBasis slack;
+            slack.setSize(numberColumns, numberRows);
+            for (iColumn = 0; iColumn < numberColumns; iColumn++)
+              slack.setStructStatus(iColumn, CoinWarmStartBasis::atLowerBound);
+            for (iRow = 0; iRow < numberRows; iRow++)
+              slack.setArtifStatus(iRow, CoinWarmStartBasis::basic);
+            model->setWarmStart(&slack);
+            const double *activity = model->getRowActivity();
+            for (iRow = 0; iRow < numberRows; iRow++) {
+              if (fabs(activity[iRow] - rowActivity[iRow]) > primalTolerance * (1.0 + fabs(rowActivity[iRow])))
+                break;
+            }
+            solved = (iRow == numberRows);
+            if (solved) {
+              double dualTolerance;
+              model->getDblParam(OsiDualTolerance, dualTolerance);
+              const double *objective = model->getObjCoefficients();
+              const double *djs = model->getReducedCost();
+              for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+                if (fabs(djs[iColumn] - objective[iColumn]) > dualTolerance * (1.0 + fabs(objective[iColumn])))
+                  break;
+              }
+              solved = (iColumn == numberColumns);
+            }
+          }
+          delete[] rowActivity;
+        }
+      }
+      if (!solved) {
+        {
+          int numberFixed = 0;
+          int numberColumns = model->getNumCols();
+          const double *columnLower = model->getColLower();
+          const double *columnUpper = model->getColUpper();
+          int iColumn;
+          for (iColumn = 0; iColumn < numberColumns; iColumn++) {
+            if (columnLower[iColumn] == columnUpper[iColumn])
+              numberFixed++;
+          }
+          if (numberColumns > 2000 && numberFixed < numberColumns && numberFixed * 5 > numberColumns) {
+            model->setHintParam(OsiDoPresolveInInitial, true, OsiHintTry);
+          }
         }
-      }
-      model->setHintParam(OsiDoDualInInitial, true, OsiHintTry);
-      model->initialSolve();
-      numberIterationsPost_ += model->getIterationCount();
-      if (!model->isProvenOptimal()) {
-        // try without basis
-        CoinWarmStartBasis *basis = dynamic_cast< CoinWarmStartBasis * >(model->getEmptyWarmStart());
-        model->setWarmStart(basis);
-        delete basis;
+        model->setHintParam(OsiDoDualInInitial, true, OsiHintTry);
         model->initialSolve();
-      }
-      if (!model->isProvenOptimal()) {
+        numberIterationsPost_ += model->getIterationCount();
+        if (!model->isProvenOptimal()) {
+          // try without basis
+          CoinWarmStartBasis *basis = dynamic_cast< CoinWarmStartBasis * >(model->getEmptyWarmStart());
+          model->setWarmStart(basis);
+          delete basis;
+          model->initialSolve();
+        }
+        if (!model->isProvenOptimal()) {
 #if COIN_DEVELOP
-        whichMps++;
-        sprintf(nameMps, "bad2_%d", whichMps);
-        model->writeMps(nameMps);
-        printf("Mps file %s saved in %s at line %d\n",
-          nameMps, __FILE__, __LINE__);
-        printf("bad unwind in postprocess\n");
-        OsiSolverInterface *temp = model->clone();
-        temp->setDblParam(OsiDualObjectiveLimit, 1.0e30);
-        temp->setHintParam(OsiDoReducePrint, false, OsiHintTry);
-        temp->initialSolve();
-        if (temp->isProvenOptimal()) {
-          printf("Was infeasible on objective limit\n");
-        }
-        delete temp;
+          whichMps++;
+          sprintf(nameMps, "bad2_%d", whichMps);
+          model->writeMps(nameMps);
+          printf("Mps file %s saved in %s at line %d\n",
+            nameMps, __FILE__, __LINE__);
+          printf("bad unwind in postprocess\n");
+          OsiSolverInterface *temp = model->clone();
+          temp->setDblParam(OsiDualObjectiveLimit, 1.0e30);
+          temp->setHintParam(OsiDoReducePrint, false, OsiHintTry);
+          temp->initialSolve();
+          if (temp->isProvenOptimal()) {
+            printf("Was infeasible on objective limit\n");
+          }
+          delete temp;
 #endif
-      } else {
+        } else {
 #if COIN_DEVELOP > 1
-        whichMps++;
-        sprintf(nameMps, "good2_%d", whichMps);
-        model->writeMps(nameMps);
-        printf("Mps file %s saved in %s at line %d\n",
-          nameMps, __FILE__, __LINE__);
+          whichMps++;
+          sprintf(nameMps, "good2_%d", whichMps);
+          model->writeMps(nameMps);
+          printf("Mps file %s saved in %s at line %d\n",
+            nameMps, __FILE__, __LINE__);
 #endif
+        }
       }
       const int *originalColumns = presolve_[iPass]->originalColumns();
       const double *columnLower = modelM->getColLower();
@@ -5624,7 +5727,10 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
         model->setWarmStart(presolvedBasis);
       delete presolvedBasis;
       presolve_[iPass]->postsolve(true);
-      // and fix values
+      // and fix values - gather and set in one go
+      int numberBounds = 0;
+      int *whichBound = new int[numberColumns];
+      double *newBounds = new double[2 * numberColumns];
       for (iColumn = 0; iColumn < numberColumns; iColumn++) {
         int jColumn = originalColumns[iColumn];
         if (!modelM2->isInteger(jColumn)) {
@@ -5638,8 +5744,10 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
                 jColumn, value, solutionM2[jColumn], columnLower2[jColumn], columnUpper2[jColumn],
                 columnLower[iColumn], columnUpper[iColumn]);
 #endif
-              modelM2->setColLower(jColumn, value);
-              modelM2->setColUpper(jColumn, value);
+              whichBound[numberBounds] = jColumn;
+              newBounds[2 * numberBounds] = value;
+              newBounds[2 * numberBounds + 1] = value;
+              numberBounds++;
             }
           } else {
 #if CBC_USEFUL_PRINTING
@@ -5656,6 +5764,9 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
 	      int jColumn = original[iColumn];
 	      if (scBound[jColumn]!=-COIN_DBL_MAX) {
 		double lower =scBound[jColumn];
+		// keep order - put in what we have so far
+		modelM2->setColSetBounds(whichBound, whichBound + numberBounds, newBounds);
+		numberBounds = 0;
 		modelM2->setColLower(iColumn, lower);
 	      }
 	    }
@@ -5666,14 +5777,24 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
           if (value < columnLower2[jColumn]) {
             //printf("changing lower bound for %d from %g to %g to allow feasibility\n",
             //	   jColumn,columnLower2[jColumn],value);
-            modelM2->setColLower(jColumn, value);
+            whichBound[numberBounds] = jColumn;
+            newBounds[2 * numberBounds] = value;
+            newBounds[2 * numberBounds + 1] = columnUpper2[jColumn];
+            numberBounds++;
           } else if (value > columnUpper2[jColumn]) {
             //printf("changing upper bound for %d from %g to %g to allow feasibility\n",
             //	   jColumn,columnUpper2[jColumn],value);
-            modelM2->setColUpper(jColumn, value);
+            whichBound[numberBounds] = jColumn;
+            newBounds[2 * numberBounds] = columnLower2[jColumn];
+            newBounds[2 * numberBounds + 1] = value;
+            numberBounds++;
           }
         }
       }
+      if (numberBounds)
+        modelM2->setColSetBounds(whichBound, whichBound + numberBounds, newBounds);
+      delete[] whichBound;
+      delete[] newBounds;
       if (deleteStuff) {
         delete modifiedModel_[iPass];
         ;
@@ -5685,8 +5806,8 @@ void CglPreProcess::postProcess(OsiSolverInterface &modelIn, int deleteStuff)
         presolve_[iPass] = NULL;
       }
       modelM = modelM2;
-      delete [] original;
     }
+    delete[] originalByPass;
     // should be back to startModel_;
     OsiSolverInterface *model = originalModel_;
     // Use number of columns in original
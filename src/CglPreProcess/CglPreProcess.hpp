@@ -464,6 +464,16 @@ private:
   //@}
 };
 
+//#############################################################################
+/** A function that tests the methods in the CglPreProcess class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+CGLLIB_EXPORT
+void CglPreProcessUnitTest(const OsiSolverInterface *siP,
+  const std::string mpdDir);
+
 /// For Bron-Kerbosch
 class CGLLIB_EXPORT CglBK {
 
@@ -0,0 +1,85 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CglPreProcess.hpp"
+
+void CglPreProcessUnitTest(const OsiSolverInterface *baseSiP,
+  const std::string mpsDir)
+{
+  /*
+    Test postprocessing when every column is fixed.
+    3x3 assignment problem - x(3*i+j) is 1 if i is assigned to j.
+    The LP relaxation is integral so fixing all columns of the
+    preprocessed model at its LP solution is what branch and bound
+    would give.  Unique optimum is x1 = x3 = x8 = 1 with cost 5.
+  */
+  {
+    int start[10] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18 };
+    int row[18] = { 0, 3, 0, 4, 0, 5, 1, 3, 1, 4, 1, 5, 2, 3, 2, 4, 2, 5 };
+    double element[18];
+    for (int i = 0; i < 18; i++)
+      element[i] = 1.0;
+    double columnLower[9];
+    double columnUpper[9];
+    for (int i = 0; i < 9; i++) {
+      columnLower[i] = 0.0;
+      columnUpper[i] = 1.0;
+    }
+    double objective[9] = { 4.0, 1.0, 3.0, 2.0, 0.0, 5.0, 3.0, 2.0, 2.0 };
+    double rowLower[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    double rowUpper[6] = { 1.0, 1.0, 1.0, 1.0, 1.0, 1.0 };
+    CoinPackedMatrix matrix(true, 6, 9, 18, element, row, start, NULL);
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    for (int i = 0; i < 9; i++)
+      siP->setInteger(i);
+    siP->setHintParam(OsiDoReducePrint, true, OsiHintTry);
+    CglPreProcess process;
+    process.messageHandler()->setLogLevel(0);
+    OsiSolverInterface *returned = process.preProcess(*siP, false, 2);
+    assert(returned);
+    // returned model belongs to process so work on a copy
+    OsiSolverInterface *presolved = returned->clone();
+    presolved->initialSolve();
+    assert(presolved->isProvenOptimal());
+    int numberColumns = presolved->getNumCols();
+    const double *solution = presolved->getColSolution();
+    for (int i = 0; i < numberColumns; i++) {
+      double value = floor(solution[i] + 0.5);
+      assert(fabs(solution[i] - value) < 1.0e-7);
+      presolved->setColLower(i, value);
+      presolved->setColUpper(i, value);
+    }
+    presolved->resolve();
+    assert(presolved->isProvenOptimal());
+    process.postProcess(*presolved);
+    const OsiSolverInterface *original = process.originalModel();
+    assert(original->isProvenOptimal());
+    assert(fabs(original->getObjValue() - 5.0) < 1.0e-7);
+    const double *originalSolution = original->getColSolution();
+    for (int i = 0; i < 9; i++) {
+      double expected = (i == 1 || i == 3 || i == 8) ? 1.0 : 0.0;
+      assert(fabs(originalSolution[i] - expected) < 1.0e-7);
+    }
+    const double *activity = original->getRowActivity();
+    for (int i = 0; i < 6; i++)
+      assert(fabs(activity[i] - 1.0) < 1.0e-7);
+    delete presolved;
+    delete siP;
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
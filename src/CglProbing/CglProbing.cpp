@@ -21,6 +21,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "OsiRowCut.hpp"
 #include "CglProbing.hpp"
+#include "CglSolutionDigest.hpp"
 //#define PROBING_EXTRA_STUFF true
 #define PROBING_EXTRA_STUFF false
 #define FIXED_ALLOWANCE 10
@@ -2327,6 +2328,23 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
 	  if (info->inTree||(info->pass&1)!=0)
 	    multiplier=1.0;
 	  //const int * columnLength = si.getMatrixByCol()->getVectorLengths();
+	  const CglSolutionDigest * digest = info->solutionDigest;
+	  if (info->inTree&&digest&&digest->integerTolerance()<=1.0e-5&&
+	      digest->matches(si,*info)) {
+	    // in tree only fractional ones are wanted - digest has them
+	    // (in column order so ties are sorted as before)
+	    int numberFractional = digest->numberFractional(1.0e-5);
+	    memcpy(lookedAt_,digest->fractional(),numberFractional*sizeof(int));
+	    std::sort(lookedAt_,lookedAt_+numberFractional);
+	    for (int k=0;k<numberFractional;k++) {
+	      i=lookedAt_[k];
+	      if (intVar[i]&&colUpper[i]-colLower[i]>1.0e-8) {
+		double away = fabs(0.5-(colsol[i]-floor(colsol[i])));
+		array[numberThisTime_].infeasibility=away*multiplier;
+		array[numberThisTime_++].sequence=i;
+	      }
+	    }
+	  } else {
           for (i=0;i<nCols;i++) {
             if (intVar[i]&&colUpper[i]-colLower[i]>1.0e-8) {
               double away = fabs(0.5-(colsol[i]-floor(colsol[i])));
@@ -2338,6 +2356,7 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
               }
             }
           }
+	  }
 	  //printf("maxP %d num %d\n",maxProbe,numberThisTime_);
           std::sort(array,array+numberThisTime_,double_int_pair_compare());
           //numberThisTime_=CoinMin(numberThisTime_,maxProbe);
@@ -2608,14 +2627,34 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
           }
 	} 
       }
-      // allocate space
+      // allocate space - all in one pool
+      int numberNew=0;
+      int newSize=sizeActionPool_;
       for (i=0;i<number01Integers_;i++) {
 	int j=cutVector_[i].sequence;
 	if (onList[j]&&!cutVector_[i].index) {
-	  disaggregation thisOne=cutVector_[i];
-	  cutVector_[i].index=new disaggregationAction [thisOne.length];
-          cutVector_[i].length=0;
-	}
+          numberNew++;
+          newSize += cutVector_[i].length;
+        }
+      }
+      if (numberNew) {
+        disaggregationAction * pool = new disaggregationAction [CoinMax(newSize,1)];
+        CoinMemcpyN(actionPool_,sizeActionPool_,pool);
+        int put=sizeActionPool_;
+        for (i=0;i<number01Integers_;i++) {
+          int j=cutVector_[i].sequence;
+          if (cutVector_[i].index) {
+            // existing - move across
+            cutVector_[i].index = pool + (cutVector_[i].index-actionPool_);
+          } else if (onList[j]) {
+            cutVector_[i].index = pool + put;
+            put += cutVector_[i].length;
+            cutVector_[i].length=0;
+          }
+        }
+        delete [] actionPool_;
+        actionPool_ = pool;
+        sizeActionPool_ = newSize;
       }
       // now put in
       for (iCut=0;iCut<nCuts;iCut++) {
@@ -3033,40 +3072,38 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
     }
     if (cutVector_) {
       // now see if any disaggregation cuts are violated
+      // all are of form element0*x[column0] + element1*x[column1] <= rhs
+      // so gather candidates first and then evaluate in one go
+      int maximumCandidates=0;
+      for (i=0;i<number01Integers_;i++)
+        maximumCandidates += cutVector_[i].length;
+      int * column0 = new int [2*maximumCandidates];
+      int * column1 = column0 + maximumCandidates;
+      double * element0 = new double [4*maximumCandidates];
+      double * element1 = element0 + maximumCandidates;
+      double * rhs = element1 + maximumCandidates;
+      double * violation = rhs + maximumCandidates;
+      int numberCandidates=0;
       for (i=0;i<number01Integers_;i++) {
 	int j=cutVector_[i].sequence;
 	double solInt=colsol[j];
-	double  upper, solValue;
-	int icol;
-	int index[2];
-	double element[2];
 	if (colUpper[j]-colLower[j]>1.0e-8) {
 	  double away = fabs(0.5-(solInt-floor(solInt)));
 	  if (away<0.4999999) {
-	    disaggregation thisOne=cutVector_[i];
-	    int k;
-	    OsiRowCut rc;
-	    for (k=0;k<thisOne.length;k++) {
-	      icol = affectedInDisaggregation(thisOne.index[k]);
+	    const disaggregation & thisOne=cutVector_[i];
+	    for (int k=0;k<thisOne.length;k++) {
+	      int icol = affectedInDisaggregation(thisOne.index[k]);
               if (zeroOneInDisaggregation(thisOne.index[k]))
                 icol = cutVector_[icol].sequence;
-	      solValue=colsol[icol];
-	      upper=colUpper_[icol];
-              double infeasibility=0.0;
+	      double upper=colUpper_[icol];
               if (!whenAtUBInDisaggregation(thisOne.index[k])) {
                 if (!affectedToUBInDisaggregation(thisOne.index[k])) {
                   // delta -> 0 => x to lb (at present just 0)
-                  infeasibility = solValue - upper * solInt;
-                  if (infeasibility > 1.0e-3) {
-                    rc.setLb(-COIN_DBL_MAX);
-                    rc.setUb(0.0);
-                    index[0]=icol;
-                    element[0]=1.0;
-                    index[1]=j;
-                    element[1]= -upper;
-                  } else {
-                    infeasibility=0.0;
-                  }
+                  column0[numberCandidates]=icol;
+                  element0[numberCandidates]=1.0;
+                  column1[numberCandidates]=j;
+                  element1[numberCandidates]=-upper;
+                  rhs[numberCandidates++]=0.0;
                 } else {
                   // delta -> 0 => x to ub
                   abort();
@@ -3074,70 +3111,65 @@ int CglProbing::gutsOfGenerateCuts(const OsiSolverInterface & si,
               } else {
                 if (affectedToUBInDisaggregation(thisOne.index[k])) {
                   // delta -> 1 => x to ub (?)
-                  icol = affectedInDisaggregation(thisOne.index[k]);
-                  if (zeroOneInDisaggregation(thisOne.index[k]))
-                    icol = cutVector_[icol].sequence;
-                  solValue=colsol[icol];
-                  upper=colUpper_[icol];
                   if (!colLower[icol]) {
-                    infeasibility = upper * solInt - solValue;
-                    if (infeasibility > 1.0e-3) {
-                      rc.setLb(-COIN_DBL_MAX);
-                      rc.setUb(0.0);
-                      index[0]=icol;
-                      element[0]=-1.0;
-                      index[1]=j;
-                      element[1]= upper;
-                    } else {
-                      infeasibility=0.0;
-                    }
+                    column0[numberCandidates]=icol;
+                    element0[numberCandidates]=-1.0;
+                    column1[numberCandidates]=j;
+                    element1[numberCandidates]=upper;
+                    rhs[numberCandidates++]=0.0;
                   } else {
                     assert (upper==colLower[icol]);
-                    infeasibility=0.0;
                   }
                 } else {
                   // delta + delta2 <= 1
                   assert (zeroOneInDisaggregation(thisOne.index[k]));
                   // delta -> 1 => delta2 -> 0
-                  icol = affectedInDisaggregation(thisOne.index[k]);
-                  icol = cutVector_[icol].sequence;
                   // only do if icol > j
                   if (icol >j && colUpper[icol] ) {
-                    solValue=colsol[icol];
                     if (!colLower[icol]) {
-                      infeasibility = solInt + solValue - 1.0;
-                      if (infeasibility > 1.0e-3) {
-                        rc.setLb(-COIN_DBL_MAX);
-                        rc.setUb(1.0);
-                        index[0]=icol;
-                        element[0]=1.0;
-                        index[1]=j;
-                        element[1]= 1.0;
-                      } else {
-                        infeasibility=0.0;
-                      }
+                      column0[numberCandidates]=icol;
+                      element0[numberCandidates]=1.0;
+                      column1[numberCandidates]=j;
+                      element1[numberCandidates]=1.0;
+                      rhs[numberCandidates++]=1.0;
                     } else {
                       assert (upper==colLower[icol]);
-                      infeasibility=0.0;
                     }
                   }
                 }
               }
-              if (infeasibility) {
-                rc.setEffectiveness(infeasibility);
-                rc.setRow(2,index,element,false);
-                if (logLevel_>1)
-                  printf("%g <= %g * x%d + %g * x%d <= %g\n",
-                         rc.lb(),element[0],index[0],element[1],index[1],rc.ub());
-#ifdef CGL_DEBUG
-                if (debugger) assert(!debugger->invalidCut(rc)); 
-#endif
-                rowCut.addCutIfNotDuplicate(rc);
-              }
 	    }
 	  }
 	}
       }
+      // evaluate all at once
+      for (int k=0;k<numberCandidates;k++)
+        violation[k] = element0[k]*colsol[column0[k]] +
+          element1[k]*colsol[column1[k]] - rhs[k];
+      for (int k=0;k<numberCandidates;k++) {
+        if (violation[k] > 1.0e-3) {
+          OsiRowCut rc;
+          int index[2];
+          double element[2];
+          index[0]=column0[k];
+          element[0]=element0[k];
+          index[1]=column1[k];
+          element[1]=element1[k];
+          rc.setLb(-COIN_DBL_MAX);
+          rc.setUb(rhs[k]);
+          rc.setEffectiveness(violation[k]);
+          rc.setRow(2,index,element,false);
+          if (logLevel_>1)
+            printf("%g <= %g * x%d + %g * x%d <= %g\n",
+                   rc.lb(),element[0],index[0],element[1],index[1],rc.ub());
+#ifdef CGL_DEBUG
+          if (debugger) assert(!debugger->invalidCut(rc)); 
+#endif
+          rowCut.addCutIfNotDuplicate(rc);
+        }
+      }
+      delete [] column0;
+      delete [] element0;
     }
   }
   delete [] markR;
@@ -3883,7 +3915,14 @@ int CglProbing::probe( const OsiSolverInterface & si,
     fixEntries=probingInfo->fixEntries();
 #endif
   } else {
-    saveFixingInfo = (info->initializeFixing(&si)>0);
+    int fixingState = info->initializeFixing(&si);
+    saveFixingInfo = (fixingState>0);
+    if (fixingState==1&&numberCliques_) {
+      // share clique table so implication generator can use it
+      CglTreeProbingInfo * treeInfo = dynamic_cast<CglTreeProbingInfo *> (info);
+      if (treeInfo)
+        treeInfo->setCliques(numberCliques_,cliqueStart_,cliqueEntry_);
+    }
   }
   while (ipass<maxPass&&nfixed) {
     int iLook;
@@ -10111,14 +10150,13 @@ void CglProbing::deleteSnapshot()
   rowUpper_=NULL;
   colLower_=NULL;
   colUpper_=NULL;
-  int i;
-  for (i=0;i<number01Integers_;i++) {
-    delete [] cutVector_[i].index;
-  }
   delete [] cutVector_;
+  delete [] actionPool_;
   numberIntegers_=0;
   number01Integers_=0;
   cutVector_=NULL;
+  actionPool_=NULL;
+  sizeActionPool_=0;
 }
 // Mode stuff
 void CglProbing::setMode(int mode)
@@ -10318,6 +10356,8 @@ usingObjective_(0)
   totalTimesCalled_=0;
   lookedAt_=NULL;
   cutVector_=NULL;
+  actionPool_=NULL;
+  sizeActionPool_=0;
   numberCliques_=0;
   cliqueType_=NULL;
   cliqueStart_=NULL;
@@ -10370,10 +10410,11 @@ CglProbing::CglProbing (  const CglProbing & rhs)
     number01Integers_=rhs.number01Integers_;
     cutVector_=new disaggregation [number01Integers_];
     CoinMemcpyN(rhs.cutVector_,number01Integers_,cutVector_);
+    sizeActionPool_=rhs.sizeActionPool_;
+    actionPool_ = CoinCopyOfArray(rhs.actionPool_,CoinMax(sizeActionPool_,1));
     for (i=0;i<number01Integers_;i++) {
-      if (cutVector_[i].index) {
-	cutVector_[i].index = CoinCopyOfArray(rhs.cutVector_[i].index,cutVector_[i].length);
-      }
+      if (cutVector_[i].index) 
+	cutVector_[i].index = actionPool_ + (rhs.cutVector_[i].index-rhs.actionPool_);
     }
   } else {
     rowCopy_=NULL;
@@ -10385,6 +10426,8 @@ CglProbing::CglProbing (  const CglProbing & rhs)
     numberIntegers_=0;
     number01Integers_=0;
     cutVector_=NULL;
+    actionPool_=NULL;
+    sizeActionPool_=0;
   }
   numberThisTime_=rhs.numberThisTime_;
   totalTimesCalled_=rhs.totalTimesCalled_;
@@ -10483,12 +10526,8 @@ CglProbing::~CglProbing ()
   delete [] whichClique_;
   delete [] cliqueRow_;
   delete [] cliqueRowStart_;
-  if (cutVector_) {
-    for (int i=0;i<number01Integers_;i++) {
-      delete [] cutVector_[i].index;
-    }
-    delete [] cutVector_;
-  }
+  delete [] cutVector_;
+  delete [] actionPool_;
   delete [] tightenBounds_;
   assert(minR_==NULL);
   assert(maxR_==NULL);
@@ -10526,6 +10565,8 @@ CglProbing::operator=(
     delete [] cliqueRow_;
     delete [] cliqueRowStart_;
     delete [] tightenBounds_;
+    delete [] cutVector_;
+    delete [] actionPool_;
     mode_=rhs.mode_;
     rowCuts_=rhs.rowCuts_;
     maxPass_=rhs.maxPass_;
@@ -10558,16 +10599,13 @@ CglProbing::operator=(
       int i;
       numberIntegers_=rhs.numberIntegers_;
       number01Integers_=rhs.number01Integers_;
-      for (i=0;i<number01Integers_;i++) {
-        delete [] cutVector_[i].index;
-      }
-      delete [] cutVector_;
       cutVector_=new disaggregation [number01Integers_];
       CoinMemcpyN(rhs.cutVector_,number01Integers_,cutVector_);
+      sizeActionPool_=rhs.sizeActionPool_;
+      actionPool_ = CoinCopyOfArray(rhs.actionPool_,CoinMax(sizeActionPool_,1));
       for (i=0;i<number01Integers_;i++) {
-        if (cutVector_[i].index) {
-          cutVector_[i].index = CoinCopyOfArray(rhs.cutVector_[i].index,cutVector_[i].length);
-        }
+        if (cutVector_[i].index)
+          cutVector_[i].index = actionPool_ + (rhs.cutVector_[i].index-rhs.actionPool_);
       }
     } else {
       rowCopy_=NULL;
@@ -10579,6 +10617,8 @@ CglProbing::operator=(
       numberIntegers_=0;
       number01Integers_=0;
       cutVector_=NULL;
+      actionPool_=NULL;
+      sizeActionPool_=0;
     }
     numberThisTime_=rhs.numberThisTime_;
     totalTimesCalled_=rhs.totalTimesCalled_;
@@ -11297,6 +11337,8 @@ CglImplication::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 				const CglTreeInfo info)
 {
   if (probingInfo_) {
+    // make sure implications are in order
+    probingInfo_->toZero();
     //int n1=cs.sizeRowCuts();
     probingInfo_->generateCuts(si,cs,info);
     //int n2=cs.sizeRowCuts();
@@ -438,6 +438,10 @@ private:
     disaggregationAction * index; // columns whose bounds will be changed
   } disaggregation;
   disaggregation * cutVector_;
+  /// Pooled space for all index arrays in cutVector_
+  disaggregationAction * actionPool_;
+  /// Number of entries in actionPool_
+  int sizeActionPool_;
   /// Cliques
   /// Number of cliques
   int numberCliques_;
@@ -214,5 +214,80 @@ CglProbingUnitTest(
     delete siP;
   }
 
+  // Test implication generator using stored clique
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    // 2x0 + 2x1 + 2x2 <= 3 - maximize x0+x1+x2
+    int row[]={0,0,0};
+    int column[]={0,1,2};
+    double element[]={2.0,2.0,2.0};
+    CoinPackedMatrix matrix(false,row,column,element,3);
+    double collb[]={0.0,0.0,0.0};
+    double colub[]={1.0,1.0,1.0};
+    double obj[]={-1.0,-1.0,-1.0};
+    double rowlb[]={-COIN_DBL_MAX};
+    double rowub[]={3.0};
+    siP->loadProblem(matrix,collb,colub,obj,rowlb,rowub);
+    for (int i=0;i<3;i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    CglTreeProbingInfo info(siP);
+    info.initializeFixing(siP);
+    CoinBigIndex start[]={0,3};
+    CliqueEntry entries[3];
+    for (int i=0;i<3;i++) {
+      entries[i].fixes=0;
+      setSequenceInCliqueEntry(entries[i],i);
+      setOneFixesInCliqueEntry(entries[i],true);
+    }
+    info.setCliques(1,start,entries);
+    assert (info.numberCliques()==1);
+    const int * which;
+    assert (info.cliquesOf(1,which)==1);
+    assert (which[0]==0);
+    CglTreeProbingInfo info2(info);
+    assert (info2.numberCliques()==1);
+    CglImplication implication(&info);
+    OsiCuts osicuts;
+    implication.generateCuts(*siP,osicuts);
+    assert (osicuts.sizeRowCuts()==1);
+    OsiRowCut rcut = osicuts.rowCut(0);
+    assert (rcut.row().getNumElements()==3);
+    assert (eq(rcut.ub(),1.0));
+    delete siP;
+  }
+
+  // Test finding cliques from matrix
+  {
+    OsiSolverInterface  * siP = baseSiP->clone();
+    // x0 + x1 + x2 <= 1, x3 + x4 = 1
+    int row[]={0,0,0,1,1};
+    int column[]={0,1,2,3,4};
+    double element[]={1.0,1.0,1.0,1.0,1.0};
+    CoinPackedMatrix matrix(false,row,column,element,5);
+    double collb[]={0.0,0.0,0.0,0.0,0.0};
+    double colub[]={1.0,1.0,1.0,1.0,1.0};
+    double obj[]={-1.0,-1.0,-1.0,-1.0,-1.0};
+    double rowlb[]={-COIN_DBL_MAX,1.0};
+    double rowub[]={1.0,1.0};
+    siP->loadProblem(matrix,collb,colub,obj,rowlb,rowub);
+    for (int i=0;i<5;i++)
+      siP->setInteger(i);
+    CglTreeProbingInfo info(siP);
+    assert (!info.findCliques(*siP));
+    assert (info.numberCliques()==2);
+    const char * type = info.cliqueType();
+    assert ((type[0]=='S'&&type[1]=='E')||(type[0]=='E'&&type[1]=='S'));
+    const int * which;
+    assert (info.cliquesOf(4,which)==1);
+    // nothing new from probing so no solver unless asked
+    assert (!info.analyze(*siP,1));
+    OsiSolverInterface * cliqueSolver = info.analyze(*siP,1,-1);
+    assert (cliqueSolver);
+    assert (cliqueSolver->getNumRows()==2);
+    delete cliqueSolver;
+    delete siP;
+  }
+
 }
 
@@ -32,6 +32,7 @@
 #include "CoinFactorization.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CglRedSplit.hpp"
+#include "CglImpliedIntegers.hpp"
 #include "CoinFinite.hpp"
 
 //-------------------------------------------------------------------
@@ -399,8 +400,29 @@ void CglRedSplit::reduce_contNonBasicTab() {
 void CglRedSplit::generate_row(int index_row, double *row) {
 
   int i;
-  for(i=0; i<ncol+nrow; i++) {
-    row[i] = 0;
+  // row is only non zero where the last row was written: basic
+  // fractional integers, non basic variables and columns of non basic
+  // slacks eliminated in eliminate_slacks() - clear just those
+  // (row is all zero on first call)
+  const CoinBigIndex *rowStart = byRow->getVectorStarts();
+  const int *indices = byRow->getIndices();
+  const int *rowLength = byRow->getVectorLengths();
+  for(i=card_contNonBasicVar-1; i>=0; i--) {
+    int locind = contNonBasicVar[i];
+    if(locind < ncol) {
+      break; // slacks come after structurals
+    }
+    int iRow = locind - ncol;
+    CoinBigIndex upto = rowStart[iRow] + rowLength[iRow];
+    for(CoinBigIndex j=rowStart[iRow]; j<upto; j++) {
+      row[indices[j]] = 0;
+    }
+  }
+  for(i=0; i<card_intBasicVar_frac; i++) {
+    row[intBasicVar_frac[i]] = 0;
+  }
+  for(i=0; i<card_intNonBasicVar; i++) {
+    row[intNonBasicVar[i]] = 0;
   }
   if(!param.getUSE_CG2()) { 
        // coeff will become zero in generate_cgcut_2() anyway
@@ -408,12 +430,16 @@ void CglRedSplit::generate_row(int index_row, double *row) {
       row[intBasicVar_frac[i]] += pi_mat[index_row][i];
     }
   }
-  for(i=0; i<card_intNonBasicVar; i++) {
-    int locind = intNonBasicVar[i];
-    row[locind] = 0;
-    int j;
-    for(j=0; j<mTab; j++) {
-      row[locind] += pi_mat[index_row][j] * intNonBasicTab[j][i];
+  // add in one tableau row at a time (as in CglRedSplit2) - rows are
+  // contiguous and most multipliers are zero
+  const int *pi = pi_mat[index_row];
+  for(int j=0; j<mTab; j++) {
+    double value = pi[j];
+    if(value) {
+      const double *tableau = intNonBasicTab[j];
+      for(i=0; i<card_intNonBasicVar; i++) {
+	row[intNonBasicVar[i]] += value * tableau[i];
+      }
     }
   }
   for(i=0; i<card_contNonBasicVar; i++) {
@@ -549,21 +575,34 @@ void CglRedSplit::eliminate_slacks(double *row,
 				   const int *rowLength,
 				   const double *rhs, double *tabrowrhs) {
 
-  for(int i=0; i<nrow; i++) {
-    if(fabs(row[ncol+i]) > param.getEPS_ELIM()) {
-
-      if(rowLower[i] > rowUpper[i] - param.getEPS()) {
-	row[ncol+i] = 0;
+  const double epsElim = param.getEPS_ELIM();
+  const double eps = param.getEPS();
+  double *slackPart = row + ncol;
+  double tabrhs = *tabrowrhs;
+  // only non basic slacks can be non zero - they are at end of
+  // contNonBasicVar in increasing order
+  int first = card_contNonBasicVar;
+  while((first > 0) && (contNonBasicVar[first-1] >= ncol)) {
+    first--;
+  }
+  for(int k=first; k<card_contNonBasicVar; k++) {
+    int i = contNonBasicVar[k] - ncol;
+    double value = slackPart[i];
+    if(fabs(value) > epsElim) {
+
+      if(rowLower[i] > rowUpper[i] - eps) {
+	slackPart[i] = 0;
 	continue;
       }
 
       CoinBigIndex upto = rowStart[i] + rowLength[i];
       for(CoinBigIndex j=rowStart[i]; j<upto; j++) {
-	row[indices[j]] -= row[ncol+i] * elements[j];
+	row[indices[j]] -= value * elements[j];
       }
-      *tabrowrhs -= row[ncol+i] * rhs[i];
+      tabrhs -= value * rhs[i];
     }
   }
+  *tabrowrhs = tabrhs;
 
 #ifdef RS_TRACEALL
   rs_printvecDBL("CglRedSplit::eliminate_slacks: row", row, ncol+nrow);
@@ -1161,7 +1200,7 @@ bool CglRedSplit::rs_are_different_matrices(const CoinPackedMatrix *mat1,
 
 /************************************************************************/
 void CglRedSplit::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
-			       const CglTreeInfo )
+			       const CglTreeInfo info)
 {
   solver = const_cast<OsiSolverInterface *>(&si);
   if(solver == NULL) {
@@ -1194,6 +1233,11 @@ void CglRedSplit::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   rowActivity = solver->getRowActivity();
   colType = NULL;
   byRow = solver->getMatrixByRow();
+  // continuous columns known to be integer (if for this model)
+  impliedIntegers = info.impliedIntegers;
+  if (impliedIntegers && (impliedIntegers->numberColumns() != ncol ||
+			  impliedIntegers->numberRows() != nrow))
+    impliedIntegers = NULL;
 
   solver->enableFactorization();
   generateCuts(cs);
@@ -1523,6 +1567,7 @@ double *slack_val = new double[nrow];
 
   int card_row;
   double *row = new double[ncol+nrow];
+  CoinZeroN(row, ncol+nrow); // generate_row() only clears what it wrote
   int *rowind = new int[ncol];
   double *rowelem = new double[ncol];
 
@@ -1646,6 +1691,11 @@ void CglRedSplit::compute_is_integer() {
 	  // continuous variable fixed to an integer value
 	  is_integer[i] = 1;
 	}
+	else if (impliedIntegers &&
+		 impliedIntegers->isInteger(i, colLower[i], colUpper[i])) {
+	  // continuous variable implied to be integer
+	  is_integer[i] = 1;
+	}
 	else {
 	  is_integer[i] = 0;
 	}
@@ -1664,6 +1714,11 @@ void CglRedSplit::compute_is_integer() {
 	  // continuous variable fixed to an integer value
 	  is_integer[i] = 1;
 	}
+	else if (impliedIntegers &&
+		 impliedIntegers->isInteger(i, colLower[i], colUpper[i])) {
+	  // continuous variable implied to be integer
+	  is_integer[i] = 1;
+	}
 	else {
 	  is_integer[i] = 0;
 	}
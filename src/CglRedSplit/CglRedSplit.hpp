@@ -227,7 +227,8 @@ private:
   /// Reduce rows of contNonBasicTab.
   void reduce_contNonBasicTab();
 
-  /// Generate a row of the current LP tableau.
+  /// Generate a row of the current LP tableau. row must be zero apart
+  /// from what the previous row and eliminate_slacks() wrote.
   void generate_row(int index_row, double *row);
 
   /// Generate a mixed integer Chvatal-Gomory cut, when all non basic 
@@ -418,6 +419,9 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Optional implied integer information. Reset by each call to generateCuts().
+  const CglImpliedIntegers *impliedIntegers;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
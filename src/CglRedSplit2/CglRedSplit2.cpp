@@ -37,6 +37,7 @@
 #include "OsiSolverInterface.hpp"
 
 #include "CglRedSplit2.hpp"
+#include "CglImpliedIntegers.hpp"
 #include "CoinPackedVector.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinIndexedVector.hpp"
@@ -1613,6 +1614,11 @@ void CglRedSplit2::generateCuts(const OsiSolverInterface &si, OsiCuts & cs,
   xlp = solver->getColSolution();
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
+  // continuous columns known to be integer (if for this model)
+  impliedIntegers = info.impliedIntegers;
+  if (impliedIntegers && (impliedIntegers->numberColumns() != ncol ||
+			  impliedIntegers->numberRows() != nrow))
+    impliedIntegers = NULL;
 
   solver->enableFactorization();
   generateCuts(&cs, param.getMaxNumCuts());
@@ -2193,6 +2199,11 @@ void CglRedSplit2::compute_is_integer() {
       	// continuous variable fixed to an integer value
       	is_integer[i] = 1;
       }
+      else if (impliedIntegers &&
+	       impliedIntegers->isInteger(i, colLower[i], colUpper[i])) {
+	// continuous variable implied to be integer
+	is_integer[i] = 1;
+      }
       else {
 	is_integer[i] = 0;
       }
@@ -2461,6 +2472,7 @@ int CglRedSplit2::generateMultipliers(const OsiSolverInterface &si,
   xlp = solver->getColSolution();
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
+  impliedIntegers = NULL;
 
   solver->enableFactorization();
   if (basicVariables != NULL){
@@ -2509,6 +2521,7 @@ int CglRedSplit2::tiltLandPcut(const OsiSolverInterface* si,
   xlp = solver->getColSolution();
   rowActivity = solver->getRowActivity();
   byRow = solver->getMatrixByRow();
+  impliedIntegers = NULL;
 
   int i;
   is_integer = new int[ncol]; 
@@ -463,6 +463,9 @@ private:
   /// Pointer on solver. Reset by each call to generateCuts().
   OsiSolverInterface *solver;
 
+  /// Optional implied integer information. Reset by each call to generateCuts().
+  const CglImpliedIntegers *impliedIntegers;
+
   /// Pointer on point to separate. Reset by each call to generateCuts().
   const double *xlp;
 
@@ -0,0 +1,188 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <cfloat>
+#include <cassert>
+
+#include "CoinPragma.hpp"
+#include "CoinHelperFunctions.hpp"
+#include "CoinSort.hpp"
+#include "CoinFinite.hpp"
+#include "CglReducedCostFixing.hpp"
+#include "CglStored.hpp"
+//-------------------------------------------------------------------
+// Generate reduced cost fixing cuts
+//-------------------------------------------------------------------
+void CglReducedCostFixing::generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+  const CglTreeInfo /*info*/)
+{
+  if (numberFixed_ == numberCandidates_ || si.getNumCols() != numberColumns_)
+    return;
+  double sense = si.getObjSense();
+  double cutoff = cutoff_;
+  if (stored_)
+    cutoff = CoinMin(cutoff, stored_->bestObjective());
+  // limit is in sense of solver - ignore default (infinite) value
+  double limit;
+  if (si.getDblParam(OsiDualObjectiveLimit, limit) && fabs(limit) < 1.0e50
+    && limit * sense < cutoff)
+    cutoff = limit * sense;
+  if (cutoff > 1.0e50)
+    return;
+  double gap = cutoff - rootObjective_ + 1.0e-7 * (1.0 + fabs(cutoff));
+  // candidates are sorted so new ones follow those already fixed
+  int first = numberFixed_;
+  while (numberFixed_ < numberCandidates_ && fabs(reducedCost_[numberFixed_]) > gap)
+    numberFixed_++;
+  int n = numberFixed_ - first;
+  if (!n)
+    return;
+  int *lowerIndex = new int[2 * n];
+  int *upperIndex = lowerIndex + n;
+  double *lowerValue = new double[2 * n];
+  double *upperValue = lowerValue + n;
+  int nLower = 0;
+  int nUpper = 0;
+  for (int i = first; i < numberFixed_; i++) {
+    if (reducedCost_[i] > 0.0) {
+      // at lower - fix upper bound
+      upperIndex[nUpper] = candidate_[i];
+      upperValue[nUpper++] = value_[i];
+    } else {
+      lowerIndex[nLower] = candidate_[i];
+      lowerValue[nLower++] = value_[i];
+    }
+  }
+  OsiColCut cc;
+  cc.setLbs(nLower, lowerIndex, lowerValue);
+  cc.setUbs(nUpper, upperIndex, upperValue);
+  cc.setGloballyValid();
+  cs.insert(cc);
+  delete[] lowerIndex;
+  delete[] lowerValue;
+}
+
+// Save root information from solver
+void CglReducedCostFixing::saveRoot(const OsiSolverInterface &si)
+{
+  delete[] candidate_;
+  delete[] reducedCost_;
+  delete[] value_;
+  numberColumns_ = si.getNumCols();
+  numberFixed_ = 0;
+  double sense = si.getObjSense();
+  rootObjective_ = si.getObjValue() * sense;
+  const double *solution = si.getColSolution();
+  const double *lower = si.getColLower();
+  const double *upper = si.getColUpper();
+  const double *dj = si.getReducedCost();
+  double tolerance;
+  si.getDblParam(OsiPrimalTolerance, tolerance);
+  double djTolerance;
+  si.getDblParam(OsiDualTolerance, djTolerance);
+  candidate_ = new int[numberColumns_];
+  reducedCost_ = new double[numberColumns_];
+  value_ = new double[numberColumns_];
+  double *sortKey = new double[numberColumns_];
+  numberCandidates_ = 0;
+  for (int i = 0; i < numberColumns_; i++) {
+    if (!si.isInteger(i) || lower[i] == upper[i])
+      continue;
+    double value = dj[i] * sense;
+    if ((value > djTolerance && solution[i] < lower[i] + tolerance) || (value < -djTolerance && solution[i] > upper[i] - tolerance)) {
+      sortKey[numberCandidates_] = -fabs(value);
+      candidate_[numberCandidates_++] = i;
+    }
+  }
+  CoinSort_2(sortKey, sortKey + numberCandidates_, candidate_);
+  for (int i = 0; i < numberCandidates_; i++) {
+    int iColumn = candidate_[i];
+    double value = dj[iColumn] * sense;
+    reducedCost_[i] = value;
+    value_[i] = (value > 0.0) ? lower[iColumn] : upper[iColumn];
+  }
+  delete[] sortKey;
+}
+
+//-------------------------------------------------------------------
+// Default Constructor
+//-------------------------------------------------------------------
+CglReducedCostFixing::CglReducedCostFixing()
+  : CglCutGenerator()
+  , numberColumns_(0)
+  , numberCandidates_(0)
+  , numberFixed_(0)
+  , rootObjective_(-COIN_DBL_MAX)
+  , cutoff_(COIN_DBL_MAX)
+  , stored_(NULL)
+  , candidate_(NULL)
+  , reducedCost_(NULL)
+  , value_(NULL)
+{
+}
+
+//-------------------------------------------------------------------
+// Copy constructor
+//-------------------------------------------------------------------
+CglReducedCostFixing::CglReducedCostFixing(const CglReducedCostFixing &rhs)
+  : CglCutGenerator(rhs)
+  , numberColumns_(rhs.numberColumns_)
+  , numberCandidates_(rhs.numberCandidates_)
+  , numberFixed_(rhs.numberFixed_)
+  , rootObjective_(rhs.rootObjective_)
+  , cutoff_(rhs.cutoff_)
+  , stored_(rhs.stored_)
+{
+  candidate_ = CoinCopyOfArray(rhs.candidate_, numberCandidates_);
+  reducedCost_ = CoinCopyOfArray(rhs.reducedCost_, numberCandidates_);
+  value_ = CoinCopyOfArray(rhs.value_, numberCandidates_);
+}
+
+//-------------------------------------------------------------------
+// Clone
+//-------------------------------------------------------------------
+CglCutGenerator *
+CglReducedCostFixing::clone() const
+{
+  return new CglReducedCostFixing(*this);
+}
+
+//-------------------------------------------------------------------
+// Destructor
+//-------------------------------------------------------------------
+CglReducedCostFixing::~CglReducedCostFixing()
+{
+  delete[] candidate_;
+  delete[] reducedCost_;
+  delete[] value_;
+}
+
+//----------------------------------------------------------------
+// Assignment operator
+//-------------------------------------------------------------------
+CglReducedCostFixing &
+CglReducedCostFixing::operator=(const CglReducedCostFixing &rhs)
+{
+  if (this != &rhs) {
+    CglCutGenerator::operator=(rhs);
+    delete[] candidate_;
+    delete[] reducedCost_;
+    delete[] value_;
+    numberColumns_ = rhs.numberColumns_;
+    numberCandidates_ = rhs.numberCandidates_;
+    numberFixed_ = rhs.numberFixed_;
+    rootObjective_ = rhs.rootObjective_;
+    cutoff_ = rhs.cutoff_;
+    stored_ = rhs.stored_;
+    candidate_ = CoinCopyOfArray(rhs.candidate_, numberCandidates_);
+    reducedCost_ = CoinCopyOfArray(rhs.reducedCost_, numberCandidates_);
+    value_ = CoinCopyOfArray(rhs.value_, numberCandidates_);
+  }
+  return *this;
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
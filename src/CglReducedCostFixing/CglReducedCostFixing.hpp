@@ -0,0 +1,136 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CglReducedCostFixing_H
+#define CglReducedCostFixing_H
+
+#include <string>
+
+#include "CglCutGenerator.hpp"
+
+class CglStored;
+
+/** Reduced cost fixing from root node.
+    saveRoot keeps the root objective and, for integer columns at a
+    bound with nonzero reduced cost, the reduced cost and that bound.
+    These are sorted on decreasing absolute reduced cost so when the
+    cutoff gets tighter only the columns which have become fixable are
+    looked at.  Cutoff is the best of setCutoff, bestObjective of a
+    CglStored given to setStored and the solver's OsiDualObjectiveLimit.
+    If none of these is set nothing is fixed.  Column cuts are globally
+    valid and are only given once - fixedColumns gives all fixed so far.
+*/
+class CGLLIB_EXPORT CglReducedCostFixing : public CglCutGenerator {
+  friend CGLLIB_EXPORT void CglReducedCostFixingUnitTest(const OsiSolverInterface *siP,
+    const std::string mpdDir);
+
+public:
+  /**@name Generate Cuts */
+  //@{
+  /** Generate column cuts fixing columns whose root reduced cost is
+      more than cutoff minus root objective. */
+  virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs,
+    const CglTreeInfo info = CglTreeInfo());
+  //@}
+
+  /**@name Root information and cutoff */
+  //@{
+  /// Save root information from solver (which should be optimal)
+  void saveRoot(const OsiSolverInterface &si);
+  /// Set cutoff (in minimization sense)
+  inline void setCutoff(double value)
+  {
+    cutoff_ = value;
+  }
+  /// Cutoff (in minimization sense)
+  inline double cutoff() const
+  {
+    return cutoff_;
+  }
+  /** Set stored cuts whose bestObjective (in minimization sense) is
+      also used as cutoff.  Not owned - NULL to stop using it. */
+  inline void setStored(const CglStored *stored)
+  {
+    stored_ = stored;
+  }
+  /// Stored cuts used for cutoff (or NULL)
+  inline const CglStored *stored() const
+  {
+    return stored_;
+  }
+  /// Root objective (in minimization sense)
+  inline double rootObjective() const
+  {
+    return rootObjective_;
+  }
+  /// Number of columns which may be fixed
+  inline int numberCandidates() const
+  {
+    return numberCandidates_;
+  }
+  /// Number of columns fixed so far
+  inline int numberFixed() const
+  {
+    return numberFixed_;
+  }
+  /// Columns fixed so far (first numberFixed)
+  inline const int *fixedColumns() const
+  {
+    return candidate_;
+  }
+  //@}
+
+  /**@name Constructors and destructors */
+  //@{
+  /// Default constructor
+  CglReducedCostFixing();
+  /// Copy constructor
+  CglReducedCostFixing(const CglReducedCostFixing &rhs);
+  /// Clone
+  virtual CglCutGenerator *clone() const;
+  /// Assignment operator
+  CglReducedCostFixing &
+  operator=(const CglReducedCostFixing &rhs);
+  /// Destructor
+  virtual ~CglReducedCostFixing();
+  //@}
+
+protected:
+  /**@name Protected member data */
+  //@{
+  /// Number of columns in model
+  int numberColumns_;
+  /// Number of columns which may be fixed
+  int numberCandidates_;
+  /// Number of columns fixed so far
+  int numberFixed_;
+  /// Root objective (in minimization sense)
+  double rootObjective_;
+  /// Cutoff (in minimization sense)
+  double cutoff_;
+  /// Stored cuts used for cutoff (not owned)
+  const CglStored *stored_;
+  /// Columns which may be fixed - decreasing absolute reduced cost
+  int *candidate_;
+  /** Reduced cost (in minimization sense) of each candidate - positive
+      means at lower bound */
+  double *reducedCost_;
+  /// Bound each candidate was at
+  double *value_;
+  //@}
+};
+
+//#############################################################################
+/** A function that tests the methods in the CglReducedCostFixing class. The
+    only reason for it not to be a member method is that this way it doesn't
+    have to be compiled into the library. And that's a gain, because the
+    library should be compiled with optimization on, but this method should be
+    compiled with debugging. */
+CGLLIB_EXPORT
+void CglReducedCostFixingUnitTest(const OsiSolverInterface *siP,
+  const std::string mpdDir);
+
+#endif
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
@@ -0,0 +1,159 @@
+// Copyright (C) 2026, COIN-OR and others.  All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+
+#include <cassert>
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CglReducedCostFixing.hpp"
+#include "CglStored.hpp"
+
+// Checks cut fixes given columns (at lower) to 0 and (at upper) to 1
+static void checkFixed(const OsiColCut &cc, int numberUp, const int *up,
+  int numberDown, const int *down)
+{
+  const CoinPackedVector &ubs = cc.ubs();
+  const CoinPackedVector &lbs = cc.lbs();
+  assert(ubs.getNumElements() == numberUp);
+  assert(lbs.getNumElements() == numberDown);
+  for (int i = 0; i < numberUp; i++) {
+    assert(ubs.getIndices()[i] == up[i]);
+    assert(ubs.getElements()[i] == 0.0);
+  }
+  for (int i = 0; i < numberDown; i++) {
+    assert(lbs.getIndices()[i] == down[i]);
+    assert(lbs.getElements()[i] == 1.0);
+  }
+  assert(cc.globallyValid());
+}
+
+void CglReducedCostFixingUnitTest(const OsiSolverInterface *baseSiP,
+  const std::string mpsDir)
+{
+  // Test default constructor
+  {
+    CglReducedCostFixing aGenerator;
+    assert(aGenerator.numberCandidates() == 0);
+  }
+
+  // Test copy & assignment
+  {
+    CglReducedCostFixing rhs;
+    {
+      CglReducedCostFixing bGenerator;
+      bGenerator.setCutoff(1.0);
+      CglReducedCostFixing cGenerator(bGenerator);
+      assert(cGenerator.cutoff() == 1.0);
+      rhs = bGenerator;
+      assert(rhs.cutoff() == 1.0);
+    }
+  }
+
+  /*
+    Four 0-1 columns and a row which is not tight, so reduced costs are
+    costs.  Minimizing x0 - 1.5x1 + 2x2 + 0.5x3 the root has x1 at upper
+    and others at lower with objective -1.5.  Candidates in order are
+    x2 (2.0), x1 (1.5), x0 (1.0) and x3 (0.5).
+    Cutoff -0.4 gives a gap of 1.1 so x2 is fixed to 0 and x1 to 1,
+    cutoff -0.6 gives a gap of 0.9 so x0 is also fixed to 0.
+  */
+  int start[5] = { 0, 1, 2, 3, 4 };
+  int row[4] = { 0, 0, 0, 0 };
+  double element[4] = { 1.0, 1.0, 1.0, 1.0 };
+  double columnLower[4] = { 0.0, 0.0, 0.0, 0.0 };
+  double columnUpper[4] = { 1.0, 1.0, 1.0, 1.0 };
+  double objective[4] = { 1.0, -1.5, 2.0, 0.5 };
+  double rowLower[1] = { -COIN_DBL_MAX };
+  double rowUpper[1] = { 4.0 };
+  CoinPackedMatrix matrix(true, 1, 4, 4, element, row, start, NULL);
+  int up2[1] = { 2 };
+  int down1[1] = { 1 };
+  int up0[1] = { 0 };
+
+  // Test minimization with setCutoff
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    siP->loadProblem(matrix, columnLower, columnUpper, objective,
+      rowLower, rowUpper);
+    for (int i = 0; i < 4; i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    assert(siP->isProvenOptimal());
+    CglReducedCostFixing gen;
+    gen.saveRoot(*siP);
+    assert(gen.numberCandidates() == 4);
+    assert(fabs(gen.rootObjective() + 1.5) < 1.0e-7);
+    // no cutoff - nothing
+    OsiCuts cs;
+    gen.generateCuts(*siP, cs);
+    assert(cs.sizeColCuts() == 0);
+    gen.setCutoff(-0.4);
+    gen.generateCuts(*siP, cs);
+    assert(cs.sizeColCuts() == 1);
+    checkFixed(cs.colCut(0), 1, up2, 1, down1);
+    assert(gen.numberFixed() == 2);
+    // same cutoff - columns are not given again
+    OsiCuts cs2;
+    gen.generateCuts(*siP, cs2);
+    assert(cs2.sizeColCuts() == 0);
+    // tighter cutoff - only new column
+    gen.setCutoff(-0.6);
+    OsiCuts cs3;
+    gen.generateCuts(*siP, cs3);
+    assert(cs3.sizeColCuts() == 1);
+    checkFixed(cs3.colCut(0), 1, up0, 0, NULL);
+    assert(gen.numberFixed() == 3);
+    assert(gen.fixedColumns()[2] == 0);
+    delete siP;
+  }
+
+  // Test maximization with cutoff from CglStored
+  {
+    OsiSolverInterface *siP = baseSiP->clone();
+    double maxObjective[4];
+    for (int i = 0; i < 4; i++)
+      maxObjective[i] = -objective[i];
+    siP->loadProblem(matrix, columnLower, columnUpper, maxObjective,
+      rowLower, rowUpper);
+    siP->setObjSense(-1.0);
+    for (int i = 0; i < 4; i++)
+      siP->setInteger(i);
+    siP->initialSolve();
+    assert(siP->isProvenOptimal());
+    CglReducedCostFixing gen;
+    gen.saveRoot(*siP);
+    assert(gen.numberCandidates() == 4);
+    assert(fabs(gen.rootObjective() + 1.5) < 1.0e-7);
+    // x0 = x1 = 1 has value 0.5 (-0.5 in minimization sense)
+    CglStored stored(4);
+    double solution[4] = { 1.0, 1.0, 0.0, 0.0 };
+    stored.saveStuff(-0.5, solution, columnLower, columnUpper);
+    gen.setStored(&stored);
+    OsiCuts cs;
+    gen.generateCuts(*siP, cs);
+    assert(cs.sizeColCuts() == 1);
+    checkFixed(cs.colCut(0), 1, up2, 1, down1);
+    // x1 = x3 = 1 has value 1.0 - gap of 0.5 also fixes x0
+    solution[0] = 0.0;
+    solution[3] = 1.0;
+    stored.saveStuff(-1.0, solution, columnLower, columnUpper);
+    OsiCuts cs2;
+    gen.generateCuts(*siP, cs2);
+    assert(cs2.sizeColCuts() == 1);
+    checkFixed(cs2.colCut(0), 1, up0, 0, NULL);
+    OsiCuts cs3;
+    gen.generateCuts(*siP, cs3);
+    assert(cs3.sizeColCuts() == 0);
+    delete siP;
+  }
+}
+
+/* vi: softtabstop=2 shiftwidth=2 expandtab tabstop=2
+*/
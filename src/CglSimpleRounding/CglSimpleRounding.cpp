@@ -13,6 +13,7 @@
 #include "CoinPackedVector.hpp"
 #include "CoinSort.hpp"
 #include "CoinPackedMatrix.hpp"
+#include "CoinHelperFunctions.hpp"
 
 //-------------------------------------------------------------
 void
@@ -36,6 +37,23 @@ CglSimpleRounding::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
   const CoinPackedMatrix * rowCopy = 
     si.getMatrixByRow(); // row copy: matrix stored in row order
 
+  // Scaling of rows does not change so is cached - start again if model
+  // has changed size
+  if (nRows!=numberRows_||nCols!=numberColumns_) {
+    delete [] rowPower_;
+    delete [] rowGcd_;
+    delete [] rowIntegers_;
+    numberRows_=nRows;
+    numberColumns_=nCols;
+    rowPower_ = new int [nRows];
+    rowGcd_ = new long long int [nRows];
+    rowIntegers_ = new int [nRows];
+    for ( k=0; k<nRows; k++ ) {
+      rowPower_[k] = -2;
+      rowIntegers_[k] = -1;
+    }
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // Main loop:                                                              //
   // For every row in the matrix,                                            //
@@ -71,19 +89,49 @@ CglSimpleRounding::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
       continue;
     } 
  
+    // Cached scaling is tried if no integer variable in row is fixed
+    // (then irow has all of them).  Row may have changed since it was
+    // cached (coefficients, integrality, a different cut in the same
+    // position) so cached values are only used after checking them.
+    if (rowIntegers_[rowIndex]<0) {
+      const CoinShallowPackedVector matrixRow = rowCopy->getVector(rowIndex);
+      const int * indices = matrixRow.getIndices();
+      int nInt=0;
+      for (k=0; k<matrixRow.getNumElements(); k++) {
+	if (si.isInteger(indices[k]))
+	  nInt++;
+      }
+      rowIntegers_[rowIndex]=nInt;
+    }
+    bool wholeRow = irow.getNumElements()==rowIntegers_[rowIndex];
+
     // Euclid's greatest common divisor (gcd) algorithm applies to positive
     // INTEGERS. 
     // Determine the power of 10 needed, so that multipylying the integer
     // inequality through by 10**power makes all coefficients essentially
     // integral. 
-    int power = power10ToMakeDoubleAnInt(irow.getNumElements(),irow.getElements(),epsilon_*1.0e-4);
+    int power;
+    if (wholeRow&&rowPower_[rowIndex]>=0&&
+	power10MakesIntegral(irow.getNumElements(),irow.getElements(),
+			     rowPower_[rowIndex],epsilon_*1.0e-4)) {
+      power = rowPower_[rowIndex];
+    } else {
+      power = power10ToMakeDoubleAnInt(irow.getNumElements(),irow.getElements(),epsilon_*1.0e-4);
+      if (power<0)
+	power=-1;
+      if (wholeRow) {
+	rowPower_[rowIndex]= power>=0 ? power : -2;
+	rowGcd_[rowIndex]=0;
+      }
+    }
 
     // Now a vector to store the integer-ized values. For instance, 
     // if x[i] is .66 and power is 1000 then xInt[i] will be 660
-    int * xInt = NULL;
+    // (64 bit so large coefficients can be used)
+    long long int * xInt = NULL;
     if (power >=0) {
 
-      xInt = new int[irow.getNumElements()]; 
+      xInt = new long long int[irow.getNumElements()]; 
       double dxInt; // a double version of xInt for error trapping
       
       
@@ -93,7 +141,7 @@ CglSimpleRounding::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 
       for (k=0; k<irow.getNumElements(); k++){
 	dxInt = irow.getElements()[k]*pow(10.0,power);
-	xInt[k]= static_cast<int> (dxInt+0.5); // Need to add the 0.5 
+	xInt[k]= static_cast<long long int> (dxInt+0.5); // Need to add the 0.5 
 	// so that a dxInt=9.999 will give a xInt=1
 
 #ifdef CGL_DEBUG
@@ -118,19 +166,35 @@ CglSimpleRounding::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
     }
 
     // find greatest common divisor of the irow.elements
-    int gcd = gcdv(irow.getNumElements(), xInt);
+    long long int gcd = 0;
+    if (wholeRow&&rowGcd_[rowIndex]>0) {
+      // cached gcd must still divide every coefficient
+      gcd = rowGcd_[rowIndex];
+      for (k=0; k<irow.getNumElements(); k++) {
+	if (xInt[k]%gcd) {
+	  gcd = 0;
+	  break;
+	}
+      }
+    }
+    if (!gcd) {
+      gcd = gcdv(irow.getNumElements(), xInt);
+      if (wholeRow)
+	rowGcd_[rowIndex]=gcd;
+    }
 
 #ifdef CGL_DEBUG
-    printf("The gcd of xInt is %i\n",gcd);    
+    printf("The gcd of xInt is %lld\n",gcd);    
 #endif
 
     // construct new cut by dividing through by gcd and 
     // rounding down rhs and accounting for negatives
     CoinPackedVector cut;
     for (k=0; k<irow.getNumElements(); k++){
-        cut.insert(irow.getIndices()[k],xInt[k]/gcd);
+        cut.insert(irow.getIndices()[k],static_cast<double>(xInt[k]/gcd));
     }
-    double cutRhs = floor((b*pow(10.0,power))/gcd);
+    double dgcd = static_cast<double>(gcd);
+    double cutRhs = floor((b*pow(10.0,power))/dgcd);
 
     // un-negate the negated variables in the cut
     {
@@ -147,7 +211,7 @@ CglSimpleRounding::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
 
     // Create the row cut and add it to the set of cuts
     // It may not be violated
-    if (fabs(cutRhs*gcd-b)> epsilon_){ // if the cut and row are different. 
+    if (fabs(cutRhs*dgcd-b)> epsilon_){ // if the cut and row are different. 
       OsiRowCut rc;
       rc.setRow(cut.getNumElements(),cut.getIndices(),cut.getElements());
       rc.setLb(-COIN_DBL_MAX);
@@ -392,7 +456,8 @@ CglSimpleRounding::power10ToMakeDoubleAnInt(
 	break;
       }
     }
-    if (power==16||scaledValue>2147483647) {
+    // must be held exactly in a double (and so in 64 bit integer)
+    if (power==16||scaledValue>9007199254740992.0) {
 #ifdef CGL_DEBUG
       printf("Overflow %g => %g, power %d\n",x[i],scaledValue,power);
 #endif
@@ -413,13 +478,42 @@ CglSimpleRounding::power10ToMakeDoubleAnInt(
   return maxPower;
 }
 
+//-------------------------------------------------------------------
+// power10MakesIntegral: checks that multiplying x by 10**power makes
+//                       every value integral (to dataTol as in
+//                       power10ToMakeDoubleAnInt) without overflow
+//-------------------------------------------------------------------
+bool
+CglSimpleRounding::power10MakesIntegral(
+    int size,
+    const double * x,
+    int power,
+    double dataTol) const
+{
+  double multiplier = pow(10.0,power);
+  double tolerance = dataTol*multiplier;
+  for (int i=0; i<size; i++){
+    double scaledValue = fabs(x[i])*multiplier;
+    double fracPart = scaledValue-floor(scaledValue);
+    if (!(fracPart < tolerance || 1.0-fracPart < tolerance) ||
+	scaledValue>9007199254740992.0)
+      return false;
+  }
+  return true;
+}
+
 //-------------------------------------------------------------------
 // Default Constructor 
 //-------------------------------------------------------------------
 CglSimpleRounding::CglSimpleRounding ()
 :
 CglCutGenerator(),
-epsilon_(1.0e-08)
+epsilon_(1.0e-08),
+numberRows_(0),
+numberColumns_(0),
+rowPower_(NULL),
+rowGcd_(NULL),
+rowIntegers_(NULL)
 {
   // nothing to do here
 }
@@ -430,7 +524,12 @@ CglSimpleRounding::CglSimpleRounding (
                   const CglSimpleRounding & source)
 :
 CglCutGenerator(source),
-epsilon_(source.epsilon_)
+epsilon_(source.epsilon_),
+numberRows_(source.numberRows_),
+numberColumns_(source.numberColumns_),
+rowPower_(CoinCopyOfArray(source.rowPower_,source.numberRows_)),
+rowGcd_(CoinCopyOfArray(source.rowGcd_,source.numberRows_)),
+rowIntegers_(CoinCopyOfArray(source.rowIntegers_,source.numberRows_))
 {  
   // Nothing to do here
 }
@@ -450,7 +549,9 @@ CglSimpleRounding::clone() const
 //-------------------------------------------------------------------
 CglSimpleRounding::~CglSimpleRounding ()
 {
-  // Nothing to do here
+  delete [] rowPower_;
+  delete [] rowGcd_;
+  delete [] rowIntegers_;
 }
 
 //----------------------------------------------------------------
@@ -463,9 +564,31 @@ CglSimpleRounding::operator=(
   if (this != &rhs) {
     CglCutGenerator::operator=(rhs);
     epsilon_=rhs.epsilon_;
+    delete [] rowPower_;
+    delete [] rowGcd_;
+    delete [] rowIntegers_;
+    numberRows_=rhs.numberRows_;
+    numberColumns_=rhs.numberColumns_;
+    rowPower_=CoinCopyOfArray(rhs.rowPower_,numberRows_);
+    rowGcd_=CoinCopyOfArray(rhs.rowGcd_,numberRows_);
+    rowIntegers_=CoinCopyOfArray(rhs.rowIntegers_,numberRows_);
   }
   return *this;
 }
+// This can be used to refresh any information
+void 
+CglSimpleRounding::refreshSolver(OsiSolverInterface * )
+{
+  // model may have changed - forget row scaling
+  delete [] rowPower_;
+  delete [] rowGcd_;
+  delete [] rowIntegers_;
+  numberRows_=0;
+  numberColumns_=0;
+  rowPower_=NULL;
+  rowGcd_=NULL;
+  rowIntegers_=NULL;
+}
 // Create C++ lines to get to current state
 std::string
 CglSimpleRounding::generateCpp( FILE * fp) 
@@ -62,6 +62,8 @@ public:
     ~CglSimpleRounding ();
   /// Create C++ lines to get to current state
   virtual std::string generateCpp( FILE * fp);
+  /// This can be used to refresh any information (clears cached row scaling)
+  virtual void refreshSolver(OsiSolverInterface * solver);
   //@}
 
 private:
@@ -93,7 +95,8 @@ private:
      dataTol should be smaller - say 1.0e-12 rather tahn 1.0e-8
 
      Returns -number of times overflowed  if the power is so big that it will
-     cause overflow (i.e. integer stored will be bigger than 2**31).
+     cause overflow (i.e. integer stored will be bigger than 2**53 so can not
+     be held exactly in a double).
      Test in cut generator.
   */ 
   int power10ToMakeDoubleAnInt( 
@@ -102,15 +105,29 @@ private:
        double dataTol ) const; // the precision of the data, i.e. the positive
                                // epsilon, which is equivalent to zero
 
+  /** Returns true if multiplying every x[i] by 10**power makes it integral
+      (to dataTol as in power10ToMakeDoubleAnInt) and exact in a double.
+      Used to check cached scaling of a row.
+  */
+  bool power10MakesIntegral(
+       int size,
+       const double * x,
+       int power,
+       double dataTol ) const;
+
   /**@name Greatest common denominators methods */
   //@{
   /// Returns the greatest common denominator of two positive integers, a and b.
   inline  int gcd(int a, int b) const; 
+  /// 64 bit version of gcd
+  inline  long long int gcd(long long int a, long long int b) const; 
   
   /** Returns the greatest common denominator of a vector of
       positive integers, vi, of length n.
   */
   inline  int gcdv(int n, const int * const vi) const; 
+  /// 64 bit version of gcdv
+  inline  long long int gcdv(int n, const long long int * const vi) const; 
   //@}
 
   //@}
@@ -119,6 +136,18 @@ private:
   //@{
   /// A value within an epsilon_ neighborhood of 0  is considered to be 0.
   double epsilon_;
+  /// Number of rows for which scaling is cached
+  int numberRows_;
+  /// Number of columns when scaling cached
+  int numberColumns_;
+  /** For each row power of 10 making integer coefficients integral,
+      -2 if not known (or overflow).  Checked before use */
+  int * rowPower_;
+  /// For each row gcd of scaled integer coefficients (0 if not known).  Checked before use
+  long long int * rowGcd_;
+  /** For each row number of integer variables. Cached values are only used
+      when none of them is fixed */
+  int * rowIntegers_;
   //@}
 };
 
@@ -141,6 +170,23 @@ CglSimpleRounding::gcd(int a, int b) const
   else return gcd(remainder,a);
 }
 
+//-------------------------------------------------------------------
+// 64 bit version of gcd
+//-------------------------------------------------------------------
+long long int 
+CglSimpleRounding::gcd(long long int a, long long int b) const
+{
+  if(a > b) {
+    // Swap a and b
+    long long int temp = a;
+    a = b;
+    b = temp;
+  }
+  long long int remainder = b % a;
+  if (remainder == 0) return a;
+  else return gcd(remainder,a);
+}
+
 //-------------------------------------------------------------------
 // Returns the greatest common denominator of a vector of
 // positive integers, vi, of length n.
@@ -161,6 +207,25 @@ CglSimpleRounding::gcdv(int n, const int* const vi) const
   return retval;
 }
 
+//-------------------------------------------------------------------
+// 64 bit version of gcdv
+//-------------------------------------------------------------------
+long long int 
+CglSimpleRounding::gcdv(int n, const long long int* const vi) const
+{
+  if (n==0)
+    abort();
+
+  if (n==1)
+    return vi[0];
+
+  long long int retval=gcd(vi[0], vi[1]);
+  for (int i=2; i<n; i++){
+     retval=gcd(retval,vi[i]);
+  }
+  return retval;
+}
+
 //#############################################################################
 /** A function that tests the methods in the CglSimpleRounding class. The
     only reason for it not to be a member method is that this way it doesn't
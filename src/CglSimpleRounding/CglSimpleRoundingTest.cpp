@@ -158,6 +158,78 @@ CglSimpleRoundingUnitTest(
 
   }
 
+  // Test row which changes but keeps its index (cached scaling is stale)
+  {
+    CglSimpleRounding cg;
+    OsiSolverInterface * siP = baseSiP->clone();
+    // 2 x0 + 4 x1 <= 5 gives x0 + 2 x1 <= 2 (power 0, gcd 2)
+    int row[2]={0,0};
+    int column[2]={0,1};
+    double element[2]={2.0,4.0};
+    double colLower[2]={0.0,0.0};
+    double colUpper[2]={10.0,10.0};
+    double objective[2]={-1.0,-1.0};
+    double rowLower[1]={-COIN_DBL_MAX};
+    double rowUpper[1]={5.0};
+    {
+      CoinPackedMatrix matrix(false,row,column,element,2);
+      siP->loadProblem(matrix,colLower,colUpper,objective,rowLower,rowUpper);
+    }
+    siP->setInteger(0);
+    siP->setInteger(1);
+    OsiCuts cuts;
+    cg.generateCuts(*siP,cuts);
+    assert (cuts.sizeRowCuts()==1);
+    assert (cuts.rowCut(0).ub()==2.0);
+    // now 1.5 x0 + 2 x1 <= 3.5 - same size so scaling stays cached but
+    // power 0 and gcd 2 would give x0 + x1 <= 1 which cuts off (1,1)
+    element[0]=1.5;
+    element[1]=2.0;
+    rowUpper[0]=3.5;
+    {
+      CoinPackedMatrix matrix(false,row,column,element,2);
+      siP->loadProblem(matrix,colLower,colUpper,objective,rowLower,rowUpper);
+    }
+    siP->setInteger(0);
+    siP->setInteger(1);
+    OsiCuts cuts2;
+    cg.generateCuts(*siP,cuts2);
+    double feasible[2]={1.0,1.0};
+    for (int i=0;i<cuts2.sizeRowCuts();i++)
+      assert (cuts2.rowCut(i).violated(feasible)<=1.0e-7);
+    delete siP;
+  }
+
+  // Test row with coefficients too large for 32 bit integers
+  {
+    CglSimpleRounding cg;
+    OsiSolverInterface * siP = baseSiP->clone();
+    // 3.0e9 x0 + 6.0e9 x1 <= 7.5e9 gives x0 + 2 x1 <= 2
+    int row[2]={0,0};
+    int column[2]={0,1};
+    double element[2]={3.0e9,6.0e9};
+    CoinPackedMatrix matrix(false,row,column,element,2);
+    double colLower[2]={0.0,0.0};
+    double colUpper[2]={10.0,10.0};
+    double objective[2]={-1.0,-1.0};
+    double rowLower[1]={-COIN_DBL_MAX};
+    double rowUpper[1]={7.5e9};
+    siP->loadProblem(matrix,colLower,colUpper,objective,rowLower,rowUpper);
+    siP->setInteger(0);
+    siP->setInteger(1);
+    OsiCuts cuts;
+    cg.generateCuts(*siP,cuts);
+    assert (cuts.sizeRowCuts()==1);
+    OsiRowCut rcut = cuts.rowCut(0);
+    CoinPackedVector rpv = rcut.row();
+    rpv.sortIncrIndex();
+    assert (rpv.getNumElements()==2);
+    assert (rpv.getElements()[0]==1.0);
+    assert (rpv.getElements()[1]==2.0);
+    assert (rcut.ub()==2.0);
+    delete siP;
+  }
+
 
 }
 
@@ -21,6 +21,7 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CoinWarmStartBasis.hpp"
 #include "CglTwomir.hpp"
+#include "CglSolutionDigest.hpp"
 class CoinWarmStartBasis;
 #define CGL_HAS_CLP_TWOMIR
 #ifdef CGL_HAS_CLP_TWOMIR
@@ -90,6 +91,9 @@ void CglTwomir::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
   //!!!!!!!!!!!!!!!!!!
   six = &si;
 # endif
+  // No cut can be violated if shared digest has all integers at integer
+  if (CglSolutionDigest::noneFractional(si, info, 1.0e-9))
+    return;
   const double * colUpper = si.getColUpper();
   const double * colLower = si.getColLower();
   const OsiSolverInterface * useSolver;
@@ -56,6 +56,9 @@ static const int MAX_CUTS = 10000000;
 #define CLEAN_THRESH 0.9
 #define MANY_IT_ZERO 10
 
+#define RANDOM_SEED 12345678 /* seed of the random numbers used by the 
+				separation, offset by the iteration count */
+
 #define mod2(I) ( I % 2 == 0 ? 0 : 1 )
 
 
@@ -594,14 +597,87 @@ printf("sense %c and rhs %d and slack %.5e\n",inp_ilp->msense[i],inp_ilp->mrhs[i
 
 /* separation graph subroutines */
 
-#define SG_EDGE_INDEX(s_graph,J,K) ( ((J) < (K)) ? ( (s_graph->nnodes * (J)) - (((J)+1)*(J)/2) + (K) - (J) -1 ) : ( (s_graph->nnodes * (K)) - (((K)+1)*(K)/2) + (J) - (K) -1 ) ) 
+/* the separation graph is stored sparsely: the edges are kept in a list
+   and located through a hash table on the (unordered) pair of endpoints
+   and the parity, so that memory and initialization grow with the number
+   of edges and not quadratically with the number of nodes - parallel
+   edges are merged on insertion by update_weight_sep_graph */
+
+#define SG_MIN_EDGES 64
+
+/* sg_hash: hash bucket of the edge with endpoints j, k and given parity */
+
+static int sg_hash(int j, int k, short int parity, int hash_size)
+{
+  unsigned long long key;
+  if ( j > k ) { int t = j; j = k; k = t; }
+  key = ( ( static_cast<unsigned long long> (j) << 32 ) |
+	  static_cast<unsigned int> (k) ) * 2 + ( parity == EVEN ? 0 : 1 );
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  return static_cast<int> (key & static_cast<unsigned long long> (hash_size - 1));
+}
+
+/* find_edge_sep_graph: return the edge of given parity between nodes
+   j and k of the separation graph, NULL if there is none */
+
+edge *find_edge_sep_graph(
+			  int j, int k, /* endpoints of the edge */
+			  short int parity, /* parity of the edge */
+			  separation_graph *s_graph /* separation graph */
+			  )
+{
+  int e;
+  edge *s_edge;
+
+  for ( e = s_graph->hash_first[sg_hash(j,k,parity,s_graph->hash_size)];
+	e >= 0; e = s_graph->hash_next[e] ) {
+    s_edge = s_graph->edge_list[e];
+    if ( s_edge->parity == parity &&
+	 ( ( s_edge->endpoint1 == j && s_edge->endpoint2 == k ) ||
+	   ( s_edge->endpoint1 == k && s_edge->endpoint2 == j ) ) )
+      return(s_edge);
+  }
+  return(NULL);
+}
+
+/* grow_sep_graph: double the room for the edges of the separation graph,
+   rehashing them when the table becomes too loaded */
+
+static void grow_sep_graph(separation_graph *s_graph)
+{
+  int e, h;
+  edge *s_edge;
+
+  s_graph->maxedges *= 2;
+  s_graph->edge_list = reinterpret_cast<edge **> 
+    (realloc(s_graph->edge_list,s_graph->maxedges*sizeof(edge *)));
+  if ( s_graph->edge_list == NULL ) alloc_error(const_cast<char*>("s_graph->edge_list"));
+  s_graph->hash_next = reinterpret_cast<int *> 
+    (realloc(s_graph->hash_next,s_graph->maxedges*sizeof(int)));
+  if ( s_graph->hash_next == NULL ) alloc_error(const_cast<char*>("s_graph->hash_next"));
+  if ( s_graph->hash_size >= 2 * s_graph->maxedges ) return;
+  /* keep the load factor of the hash table below 1/2 */
+  while ( s_graph->hash_size < 2 * s_graph->maxedges ) s_graph->hash_size *= 2;
+  free(s_graph->hash_first);
+  s_graph->hash_first = reinterpret_cast<int *> (malloc(s_graph->hash_size*sizeof(int)));
+  if ( s_graph->hash_first == NULL ) alloc_error(const_cast<char*>("s_graph->hash_first"));
+  for ( h = 0; h < s_graph->hash_size; h++ ) s_graph->hash_first[h] = -1;
+  for ( e = 0; e < s_graph->nedges; e++ ) {
+    s_edge = s_graph->edge_list[e];
+    h = sg_hash(s_edge->endpoint1,s_edge->endpoint2,s_edge->parity,s_graph->hash_size);
+    s_graph->hash_next[e] = s_graph->hash_first[h];
+    s_graph->hash_first[h] = e;
+  }
+}
   
 /* initialize_sep_graph: allocate and initialize the data structure
    to contain the information associated with a separation graph */
 
 separation_graph *Cgl012Cut::initialize_sep_graph()
 {
-  int maxnodes, maxedges, nnodes, j, jk; 
+  int maxnodes, nnodes, j, h; 
   int *nodes, *ind;
   separation_graph *s_graph;
 
@@ -637,13 +713,20 @@ separation_graph *Cgl012Cut::initialize_sep_graph()
   if ( s_graph->ind == NULL ) alloc_error(const_cast<char*>("s_graph->ind"));
   for ( j = 0; j < maxnodes; j++ ) s_graph->ind[j] = ind[j];
   free(ind);
-  maxedges = (nnodes * (nnodes - 1)) / 2;
-  s_graph->even_adj_list = reinterpret_cast<edge **> (malloc(maxedges*sizeof(edge *)));
-  if ( s_graph->even_adj_list == NULL ) alloc_error(const_cast<char*>("s_graph->even_adj_list"));
-  s_graph->odd_adj_list = reinterpret_cast<edge **> (malloc(maxedges*sizeof(edge *)));
-  if ( s_graph->odd_adj_list == NULL ) alloc_error(const_cast<char*>("s_graph->odd_adj_list"));
-  for ( jk = 0; jk < maxedges; jk++ ) 
-    s_graph->even_adj_list[jk] = s_graph->odd_adj_list[jk] = NULL;
+  /* the number of edges is not known in advance - start with room
+     for a few per node and grow geometrically */
+  s_graph->maxedges = 2 * nnodes > SG_MIN_EDGES ? 2 * nnodes : SG_MIN_EDGES;
+  s_graph->edge_list = reinterpret_cast<edge **> (malloc(s_graph->maxedges*sizeof(edge *)));
+  if ( s_graph->edge_list == NULL ) alloc_error(const_cast<char*>("s_graph->edge_list"));
+  s_graph->hash_next = reinterpret_cast<int *> (malloc(s_graph->maxedges*sizeof(int)));
+  if ( s_graph->hash_next == NULL ) alloc_error(const_cast<char*>("s_graph->hash_next"));
+  s_graph->hash_size = 1;
+  while ( s_graph->hash_size < 2 * s_graph->maxedges ) s_graph->hash_size *= 2;
+  s_graph->hash_first = reinterpret_cast<int *> (malloc(s_graph->hash_size*sizeof(int)));
+  if ( s_graph->hash_first == NULL ) alloc_error(const_cast<char*>("s_graph->hash_first"));
+  for ( h = 0; h < s_graph->hash_size; h++ ) s_graph->hash_first[h] = -1;
+  s_graph->adj_beg = NULL;
+  s_graph->adj_edge = NULL;
 
   return(s_graph);
 }
@@ -660,13 +743,11 @@ separation_graph *update_weight_sep_graph(
 					  separation_graph *s_graph /* separation graph to be updated */
 					  )
 {
-  int indj, indk, indjk;
+  int indj, indk, h;
   edge *old_edge, *new_edge;
   
   indj = s_graph->ind[j]; indk = s_graph->ind[k]; 
-  indjk = SG_EDGE_INDEX(s_graph,indj,indk);
-  if ( parity == EVEN ) old_edge = s_graph->even_adj_list[indjk];
-  else old_edge = s_graph->odd_adj_list[indjk];
+  old_edge = find_edge_sep_graph(indj,indk,parity,s_graph);
   if ( old_edge == NULL ) {
     /* edge is not in the graph */
     new_edge = reinterpret_cast<edge *> (calloc(1,sizeof(edge)));
@@ -674,9 +755,12 @@ separation_graph *update_weight_sep_graph(
     new_edge->endpoint1 = indj; new_edge->endpoint2 = indk;
     new_edge->weight = weight; new_edge->parity = parity;
     new_edge->constr = i; new_edge->weak = i_weak;
+    if ( s_graph->nedges == s_graph->maxedges ) grow_sep_graph(s_graph);
+    h = sg_hash(indj,indk,parity,s_graph->hash_size);
+    s_graph->edge_list[s_graph->nedges] = new_edge;
+    s_graph->hash_next[s_graph->nedges] = s_graph->hash_first[h];
+    s_graph->hash_first[h] = s_graph->nedges;
     (s_graph->nedges)++;
-    if ( parity == EVEN ) s_graph->even_adj_list[indjk] = new_edge;
-    else s_graph->odd_adj_list[indjk] = new_edge;
   }
   else {
     /* edge is already in the graph */
@@ -714,42 +798,102 @@ void free_edge(edge *e)
 #ifdef PRINT_CUTS
 void print_sep_graph(separation_graph *s_graph)
 {
-  int nnodes, maxedges, jk;
+  int nnodes, e;
   
   nnodes = s_graph->nnodes;
-  maxedges = (nnodes * (nnodes - 1)) / 2;
   printf("\n content of separation_graph: nnodes = %d, nedges = %d\n",
     nnodes, s_graph->nedges);
   print_int_vect(const_cast<char*>("nodes"),s_graph->nodes,nnodes);
   print_int_vect(const_cast<char*>("ind"),s_graph->ind,nnodes);
-  for ( jk = 0; jk < maxedges; jk++ ) {
-    if ( s_graph->even_adj_list[jk] != NULL )
-      print_edge(s_graph->even_adj_list[jk]);
-    if ( s_graph->odd_adj_list[jk] != NULL )
-      print_edge(s_graph->odd_adj_list[jk]);
-  }
+  for ( e = 0; e < s_graph->nedges; e++ ) 
+    print_edge(s_graph->edge_list[e]);
 }
 #endif
 
 void free_sep_graph(separation_graph *s_graph)
 {
-  int nnodes, maxedges, jk;
+  int e;
   
-  nnodes = s_graph->nnodes;
-  maxedges = (nnodes * (nnodes - 1)) / 2;
-  for ( jk = 0; jk < maxedges; jk++ ) {
-    if ( s_graph->even_adj_list[jk] != NULL )
-      free_edge(s_graph->even_adj_list[jk]);
-    if ( s_graph->odd_adj_list[jk] != NULL )
-      free_edge(s_graph->odd_adj_list[jk]);
-  }
+  for ( e = 0; e < s_graph->nedges; e++ ) 
+    free_edge(s_graph->edge_list[e]);
   free(s_graph->nodes);
   free(s_graph->ind);
-  free(s_graph->even_adj_list);
-  free(s_graph->odd_adj_list);
+  free(s_graph->edge_list);
+  free(s_graph->hash_first);
+  free(s_graph->hash_next);
+  free(s_graph->adj_beg);
+  free(s_graph->adj_edge);
   free(s_graph);
 }
 
+/* define_adj_sep_graph: build the adjacency lists of the separation 
+   graph in CSR form - the edges incident with each node are sorted by 
+   increasing other endpoint, even edge before odd edge */
+
+typedef struct {
+int key; /* 2 * other endpoint + (0 if even, 1 if odd) */
+int edge; /* index of the edge in edge_list */
+} sg_adj_entry;
+
+static int cmp_sg_adj_entry(const void *a, const void *b)
+{
+  int ka = (reinterpret_cast<const sg_adj_entry *> (a))->key;
+  int kb = (reinterpret_cast<const sg_adj_entry *> (b))->key;
+  return( ka < kb ? -1 : ( ka > kb ? 1 : 0 ) );
+}
+
+void define_adj_sep_graph(separation_graph *s_graph)
+{
+  int j, e, j1, j2, pos, par, nnodes;
+  int *fill;
+  edge *s_edge;
+  sg_adj_entry *entries;
+
+  nnodes = s_graph->nnodes;
+  free(s_graph->adj_beg);
+  free(s_graph->adj_edge);
+  s_graph->adj_beg = reinterpret_cast<int *> (calloc(nnodes+1,sizeof(int)));
+  if ( s_graph->adj_beg == NULL ) alloc_error(const_cast<char*>("s_graph->adj_beg"));
+  /* count the edges incident with each node (loops are ignored) */
+  for ( e = 0; e < s_graph->nedges; e++ ) {
+    s_edge = s_graph->edge_list[e];
+    if ( s_edge->endpoint1 == s_edge->endpoint2 ) continue;
+    s_graph->adj_beg[s_edge->endpoint1+1]++;
+    s_graph->adj_beg[s_edge->endpoint2+1]++;
+  }
+  for ( j = 0; j < nnodes; j++ ) s_graph->adj_beg[j+1] += s_graph->adj_beg[j];
+  entries = reinterpret_cast<sg_adj_entry *> 
+    (malloc((s_graph->adj_beg[nnodes]+1)*sizeof(sg_adj_entry)));
+  if ( entries == NULL ) alloc_error(const_cast<char*>("entries"));
+  fill = reinterpret_cast<int *> (malloc((nnodes+1)*sizeof(int)));
+  if ( fill == NULL ) alloc_error(const_cast<char*>("fill"));
+  for ( j = 0; j < nnodes; j++ ) fill[j] = s_graph->adj_beg[j];
+  for ( e = 0; e < s_graph->nedges; e++ ) {
+    s_edge = s_graph->edge_list[e];
+    j1 = s_edge->endpoint1; j2 = s_edge->endpoint2;
+    if ( j1 == j2 ) continue;
+    par = ( s_edge->parity == EVEN ? 0 : 1 );
+    pos = fill[j1]++;
+    entries[pos].key = 2 * j2 + par; entries[pos].edge = e;
+    pos = fill[j2]++;
+    entries[pos].key = 2 * j1 + par; entries[pos].edge = e;
+  }
+  free(fill);
+  /* sort the edges of each node, so that the auxiliary graph has its
+     arcs in the same order as an enumeration of the pairs of nodes */
+  for ( j = 0; j < nnodes; j++ ) 
+    if ( s_graph->adj_beg[j+1] - s_graph->adj_beg[j] > 1 )
+      qsort(entries + s_graph->adj_beg[j], 
+	    s_graph->adj_beg[j+1] - s_graph->adj_beg[j],
+	    sizeof(sg_adj_entry),cmp_sg_adj_entry);
+  s_graph->adj_edge = reinterpret_cast<int *> 
+    (malloc((s_graph->adj_beg[nnodes]+1)*sizeof(int)));
+  if ( s_graph->adj_edge == NULL ) alloc_error(const_cast<char*>("s_graph->adj_edge"));
+  for ( pos = 0; pos < s_graph->adj_beg[nnodes]; pos++ ) 
+    s_graph->adj_edge[pos] = entries[pos].edge;
+  free(entries);
+}
+
 /* auxiliary graph subroutines - depend on the shortest path code used */
 
 #ifndef CGL_NEW_SHORT
@@ -769,7 +913,7 @@ void free_sep_graph(separation_graph *s_graph)
      
 auxiliary_graph *define_aux_graph(separation_graph *s_graph /* input separation graph */)
 {
-  int j, k, indjk, auxj1, auxj2, auxk1, auxk2, noutj, totoutj, narcs;
+  int j, k, pos, auxj1, auxj2, auxk1, auxk2, noutj, totoutj, narcs;
   edge *s_edge;
   auxiliary_graph *a_graph;
 
@@ -792,16 +936,12 @@ auxiliary_graph *define_aux_graph(separation_graph *s_graph /* input separation
 #endif
   if ( a_graph->arcs == NULL ) alloc_error(const_cast<char*>("a_graph->arcs"));
 
+  define_adj_sep_graph(s_graph);
+
   narcs = 0; 
   for ( j = 0; j < s_graph->nnodes; j++ ) {
-    /* count the number of edges incident with j in the separation graph */
-    totoutj = 0;
-    for ( k = 0; k < s_graph->nnodes; k++ ) 
-      if ( k != j ) {
-	indjk = SG_EDGE_INDEX(s_graph,j,k);
-	if ( s_graph->even_adj_list[indjk] != NULL ) totoutj++;
-	if ( s_graph->odd_adj_list[indjk] != NULL ) totoutj++;
-      }
+    /* number of edges incident with j in the separation graph */
+    totoutj = s_graph->adj_beg[j+1] - s_graph->adj_beg[j];
     auxj1 = AG_TWIN1(j); auxj2 = AG_TWIN2(j);
     a_graph->nodes[auxj1].index = auxj1;
     a_graph->nodes[auxj2].index = auxj2;
@@ -814,49 +954,39 @@ auxiliary_graph *define_aux_graph(separation_graph *s_graph /* input separation
 #endif
     /* add the edges as arcs outgoing from j to the auxiliary graph */
     noutj = 0;
-    for ( k = 0; k < s_graph->nnodes; k++ ) {
-      if ( k != j ) {
-	auxk1 = AG_TWIN1(k); auxk2 = AG_TWIN2(k);
-	indjk = SG_EDGE_INDEX(s_graph,j,k);
-	s_edge = s_graph->even_adj_list[indjk];
-	if ( s_edge != NULL ) {
-	  /* there is an even edge between j and k */        
+    for ( pos = s_graph->adj_beg[j]; pos < s_graph->adj_beg[j+1]; pos++ ) {
+      s_edge = s_graph->edge_list[s_graph->adj_edge[pos]];
+      k = ( s_edge->endpoint1 == j ? s_edge->endpoint2 : s_edge->endpoint1 );
+      auxk1 = AG_TWIN1(k); auxk2 = AG_TWIN2(k);
+      if ( s_edge->parity == EVEN ) {
+	/* there is an even edge between j and k */        
 #ifndef CGL_NEW_SHORT
-	  a_graph->arcs[narcs].len = a_graph->arcs[narcs+totoutj].len = 
-	    (int) (s_edge->weight * ISCALE); 
-	  a_graph->arcs[narcs].head = &(a_graph->nodes[auxk1]);
-	  a_graph->arcs[narcs+totoutj].head = &(a_graph->nodes[auxk2]);
+	a_graph->arcs[narcs].len = a_graph->arcs[narcs+totoutj].len = 
+	  (int) (s_edge->weight * ISCALE); 
+	a_graph->arcs[narcs].head = &(a_graph->nodes[auxk1]);
+	a_graph->arcs[narcs+totoutj].head = &(a_graph->nodes[auxk2]);
 #else
-	  a_graph->arcs[narcs].length = a_graph->arcs[narcs+totoutj].length = 
-	    static_cast<int> (s_edge->weight * ISCALE); 
-	  a_graph->arcs[narcs].to = auxk1;
-	  a_graph->arcs[narcs+totoutj].to = auxk2;
+	a_graph->arcs[narcs].length = a_graph->arcs[narcs+totoutj].length = 
+	  static_cast<int> (s_edge->weight * ISCALE); 
+	a_graph->arcs[narcs].to = auxk1;
+	a_graph->arcs[narcs+totoutj].to = auxk2;
 #endif
-	  narcs++; noutj++; 
-	}
-	s_edge = s_graph->odd_adj_list[indjk];
-	if ( s_edge != NULL ) {
-	  /* there is an odd edge between j and k */        
+      }
+      else {
+	/* there is an odd edge between j and k */        
 #ifndef CGL_NEW_SHORT
-	  a_graph->arcs[narcs].len = a_graph->arcs[narcs+totoutj].len = 
-	    (int) (s_edge->weight * ISCALE); 
-	  a_graph->arcs[narcs].head = &(a_graph->nodes[auxk2]);
-	  a_graph->arcs[narcs+totoutj].head = &(a_graph->nodes[auxk1]);
+	a_graph->arcs[narcs].len = a_graph->arcs[narcs+totoutj].len = 
+	  (int) (s_edge->weight * ISCALE); 
+	a_graph->arcs[narcs].head = &(a_graph->nodes[auxk2]);
+	a_graph->arcs[narcs+totoutj].head = &(a_graph->nodes[auxk1]);
 #else
-	  a_graph->arcs[narcs].length = a_graph->arcs[narcs+totoutj].length = 
-	    static_cast<int> (s_edge->weight * ISCALE); 
-	  a_graph->arcs[narcs].to = auxk2;
-	  a_graph->arcs[narcs+totoutj].to = auxk1;
-#endif
-	  /* this looks really useless - to be removed ...
-	  if ( noutj == 0 ) {
-	    a_graph->nodes[auxj1].first = &(a_graph->arcs[narcs]);
-	    a_graph->nodes[auxj2].first = &(a_graph->arcs[narcs+totoutj]);
-	  } 
-	  ... */
-	  narcs++; noutj++; 
-	}
+	a_graph->arcs[narcs].length = a_graph->arcs[narcs+totoutj].length = 
+	  static_cast<int> (s_edge->weight * ISCALE); 
+	a_graph->arcs[narcs].to = auxk2;
+	a_graph->arcs[narcs+totoutj].to = auxk1;
+#endif
       }
+      narcs++; noutj++; 
     }
     narcs += totoutj;
   }
@@ -1342,12 +1472,8 @@ cycle_list *get_shortest_odd_cycle_list(
 	    curr = kt;
 	    do {
 	      pred = forw_arb[curr].pred;
-	      if ( AG_TYPE(pred,curr) == EVEN ) 
-		curr_edge = s_graph->even_adj_list
-		  [SG_EDGE_INDEX(s_graph,SG_ORIG(curr),SG_ORIG(pred))]; 
-	      else
-		curr_edge = s_graph->odd_adj_list
-		  [SG_EDGE_INDEX(s_graph,SG_ORIG(curr),SG_ORIG(pred))]; 
+	      curr_edge = find_edge_sep_graph
+		(SG_ORIG(curr),SG_ORIG(pred),AG_TYPE(pred,curr),s_graph);
 	      s_cycle->edge_list[totedges] = curr_edge;
 	      curr = pred; 
 	      totedges++;
@@ -1356,12 +1482,8 @@ cycle_list *get_shortest_odd_cycle_list(
 	    curr = kt;
 	    do {
 	      pred = backw_arb[curr].pred;
-	      if ( AG_TYPE(pred,curr) == EVEN ) 
-		curr_edge = s_graph->even_adj_list
-		  [SG_EDGE_INDEX(s_graph,SG_ORIG(curr),SG_ORIG(pred))]; 
-	      else
-		curr_edge = s_graph->odd_adj_list
-		  [SG_EDGE_INDEX(s_graph,SG_ORIG(curr),SG_ORIG(pred))]; 
+	      curr_edge = find_edge_sep_graph
+		(SG_ORIG(curr),SG_ORIG(pred),AG_TYPE(pred,curr),s_graph);
 	      s_cycle->edge_list[totedges] = curr_edge;
 	      curr = pred; 
 	      totedges++;
@@ -2995,9 +3117,10 @@ void Cgl012Cut::add_tight_constraint()
       }
     }
   }
-  if ( ntight > 0 ) i = tight[rand() % ntight];
+  if ( ntight > 0 ) 
+    i = tight[static_cast<int> (random_gen.randomDouble() * ntight) % ntight];
   /* if all constraints have already been in cur_cut choose first at random */
-  else i = rand() % m;
+  else i = static_cast<int> (random_gen.randomDouble() * m) % m;
   free(tight);
   modify_current(i,ADD);
 }    
@@ -3594,6 +3717,7 @@ print_parity_ilp();
 /* print_double_vect("xstar",p_ilp->xstar,p_ilp->mc); */
 
   sep_iter++;
+  random_gen.setSeed(RANDOM_SEED + sep_iter);
   update_log_var();
 
 #ifdef POOL
@@ -3732,7 +3856,8 @@ Cgl012Cut::Cgl012Cut () :
   errorNo(0),
   sep_iter(0),
   vlog(NULL),
-  aggr(true)
+  aggr(true),
+  random_gen(RANDOM_SEED)
 {
   // nothing to do here
 }
@@ -3748,7 +3873,8 @@ Cgl012Cut::Cgl012Cut (const Cgl012Cut & rhs) :
   errorNo(rhs.errorNo),
   sep_iter(rhs.sep_iter),
   vlog(NULL),
-  aggr(rhs.aggr)
+  aggr(rhs.aggr),
+  random_gen(rhs.random_gen)
 {
   if (rhs.p_ilp||rhs.vlog||inp_ilp)
     abort();  
@@ -3794,6 +3920,7 @@ Cgl012Cut::operator=(
     errorNo = rhs.errorNo;
     sep_iter = rhs.sep_iter;
     aggr = rhs.aggr;
+    random_gen = rhs.random_gen;
   }
   return *this;
 }
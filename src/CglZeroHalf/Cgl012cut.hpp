@@ -9,6 +9,7 @@
 #include <cmath>
 
 #include "CglConfig.h"
+#include "CoinHelperFunctions.hpp"
 
 #define CGL_NEW_SHORT
 #ifndef CGL_NEW_SHORT
@@ -115,8 +116,15 @@ int nnodes; /* number of nodes */
 int nedges; /* number of edges */
 int *nodes; /* indexes of the ILP columns corresponding to the nodes */
 int *ind; /* indexes of the nodes corresponding to the ILP columns */
-edge **even_adj_list; /* pointers to the even edges */ 
-edge **odd_adj_list; /* pointers to the odd edges */ 
+int maxedges; /* allocated size of edge_list and hash_next */
+edge **edge_list; /* pointers to the edges, in order of insertion */
+int hash_size; /* number of hash buckets (a power of 2) */
+int *hash_first; /* first edge in each hash bucket (-1 if empty) */
+int *hash_next; /* next edge in the same hash bucket (-1 if last) */
+int *adj_beg; /* start of the edges incident with each node in adj_edge
+                 (CSR form, built by define_aux_graph) */
+int *adj_edge; /* edges incident with each node, by increasing other
+                  endpoint, even before odd */
 } separation_graph;
 
 #ifndef CGL_NEW_SHORT
@@ -460,6 +468,9 @@ log_var **vlog; /* information about the value attained
 				  > 0 in a cut to be added */ 
 bool aggr; /* flag saying whether as many cuts as possible are required
 		   from the separation procedure (TRUE) or not (FALSE) */
+CoinThreadRandom random_gen; /* random numbers for the tabu search - 
+				reseeded from sep_iter at each separation,
+				so no global state is used */
   //@}
 };
 #endif
@@ -33,6 +33,7 @@
 #include "OsiVolSolverInterface.hpp"
 #endif
 
+#include "CglCutGenerator.hpp"
 #include "CglSimpleRounding.hpp"
 #include "CglKnapsackCover.hpp"
 #include "CglOddHole.hpp"
@@ -48,6 +49,8 @@
 #include "CglClique.hpp"
 #include "CglFlowCover.hpp"
 #include "CglZeroHalf.hpp"
+#include "CglReducedCostFixing.hpp"
+#include "CglPreProcess.hpp"
 
 // Function Prototypes. Function definitions is in this file.
 void testingMessage( const char * const msg );
@@ -124,6 +127,11 @@ int main (int argc, const char *argv[])
   std::cout << "Solvers:" << solvers << std::endl ;
 
 #ifdef CGL_HAS_OSICPX
+  {
+    OsiCpxSolverInterface cpxSi;
+    testingMessage( "Testing CglCommon with OsiCpxSolverInterface\n" );
+    CglCommonUnitTest(&cpxSi, testDir);
+  }
   {
     OsiCpxSolverInterface cpxSi;
     testingMessage( "Testing CglGomory with OsiCpxSolverInterface\n" );
@@ -185,10 +193,25 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglFlowCover with OsiCpxSolverInterface\n" );
     CglFlowCoverUnitTest(&cpxSi, testDir);
   }
+  {
+    OsiCpxSolverInterface cpxSi;
+    testingMessage( "Testing CglReducedCostFixing with OsiCpxSolverInterface\n" );
+    CglReducedCostFixingUnitTest(&cpxSi, testDir);
+  }
+  {
+    OsiCpxSolverInterface cpxSi;
+    testingMessage( "Testing CglPreProcess with OsiCpxSolverInterface\n" );
+    CglPreProcessUnitTest(&cpxSi, testDir);
+  }
 
 #endif
 
 #ifdef CGL_HAS_OSIXPR
+  {
+    OsiXprSolverInterface xprSi;
+    testingMessage( "Testing CglCommon with OsiXprSolverInterface\n" );
+    CglCommonUnitTest(&xprSi, testDir);
+  }
   {
     OsiXprSolverInterface xprSi;
     testingMessage( "Testing CglGomory with OsiXprSolverInterface\n" );
@@ -251,9 +274,24 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglZeroHalf with OsiXprSolverInterface\n" );
     CglZeroHalfUnitTest(&xprSi, testDir);
   }
+  {
+    OsiXprSolverInterface xprSi;
+    testingMessage( "Testing CglReducedCostFixing with OsiXprSolverInterface\n" );
+    CglReducedCostFixingUnitTest(&xprSi, testDir);
+  }
+  {
+    OsiXprSolverInterface xprSi;
+    testingMessage( "Testing CglPreProcess with OsiXprSolverInterface\n" );
+    CglPreProcessUnitTest(&xprSi, testDir);
+  }
 
 #endif
 #ifdef CGL_HAS_OSICLP
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglCommon with OsiClpSolverInterface\n" );
+    CglCommonUnitTest(&clpSi, testDir);
+  }
   {
     OsiClpSolverInterface clpSi;
     testingMessage( "Testing CglGomory with OsiClpSolverInterface\n" );
@@ -329,9 +367,24 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglZeroHalf with OsiClpSolverInterface\n" );
     CglZeroHalfUnitTest(&clpSi, testDir);
   }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglReducedCostFixing with OsiClpSolverInterface\n" );
+    CglReducedCostFixingUnitTest(&clpSi, testDir);
+  }
+  {
+    OsiClpSolverInterface clpSi;
+    testingMessage( "Testing CglPreProcess with OsiClpSolverInterface\n" );
+    CglPreProcessUnitTest(&clpSi, testDir);
+  }
 
 #endif
 #ifdef CGL_HAS_OSIDYLP
+  {
+    OsiDylpSolverInterface dylpSi;
+    testingMessage( "Testing CglCommon with OsiDylpSolverInterface\n" );
+    CglCommonUnitTest(&dylpSi, testDir);
+  }
   {
     OsiDylpSolverInterface dylpSi;
     testingMessage( "Testing CglGomory with OsiDylpSolverInterface\n" );
@@ -398,9 +451,24 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglZeroHalf with OsiDylpSolverInterface\n" );
     CglZeroHalfUnitTest(&dylpSi, testDir);
   }
+  {
+    OsiDylpSolverInterface dylpSi;
+    testingMessage( "Testing CglReducedCostFixing with OsiDylpSolverInterface\n" );
+    CglReducedCostFixingUnitTest(&dylpSi, testDir);
+  }
+  {
+    OsiDylpSolverInterface dylpSi;
+    testingMessage( "Testing CglPreProcess with OsiDylpSolverInterface\n" );
+    CglPreProcessUnitTest(&dylpSi, testDir);
+  }
 
 #endif
 #ifdef CGL_HAS_OSIGLPK
+  {
+    OsiGlpkSolverInterface glpkSi;
+    testingMessage( "Testing CglCommon with OsiGlpkSolverInterface\n" );
+    CglCommonUnitTest(&glpkSi, testDir);
+  }
   {
     OsiGlpkSolverInterface glpkSi;
     testingMessage( "Testing CglGomory with OsiGlpkSolverInterface\n" );
@@ -467,6 +535,16 @@ int main (int argc, const char *argv[])
     testingMessage( "Testing CglZeroHalf with OsiGlpkSolverInterface\n" );
     CglZeroHalfUnitTest(&glpkSi, testDir);
   }
+  {
+    OsiGlpkSolverInterface glpkSi;
+    testingMessage( "Testing CglReducedCostFixing with OsiGlpkSolverInterface\n" );
+    CglReducedCostFixingUnitTest(&glpkSi, testDir);
+  }
+  {
+    OsiGlpkSolverInterface glpkSi;
+    testingMessage( "Testing CglPreProcess with OsiGlpkSolverInterface\n" );
+    CglPreProcessUnitTest(&glpkSi, testDir);
+  }
 
 #endif
 